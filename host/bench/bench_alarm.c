@@ -0,0 +1,60 @@
+/*
+ * bench_alarm.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "clock_control.h"
+#include "alarm.h"
+#include "sim.h"
+
+// Times the due check run on every alarm event, and the rebuild after the
+// time was set, with the table filling up from 0 to ALARM_MAX alarms. The due
+// check looks at the head of the firing order only, so it stays flat.
+
+#define CALLS_DEFAULT 10000000
+// 2026-10-16 07:59:30
+#define START_SECOND  1792137570u
+
+int main(int argc, char **argv) {
+	uint32_t calls = (argc > 1) ? strtoul(argv[1], NULL, 0) : CALLS_DEFAULT;
+	Time t = GetCurrTime(START_SECOND);
+	volatile int32_t sink = 0;
+
+	ALARM_Init();
+	printf("%-8s %12s %12s\n", "alarms", "due ns", "rebuild ns");
+	for (uint32_t fill = 0; fill <= ALARM_MAX; fill++) {
+		uint64_t start;
+		uint64_t due_ns;
+		uint64_t rebuild_ns;
+
+		if (fill > 0) {
+			// spread over the day, all still ahead
+			Alarm alarm = { 9 * 3600 + fill * 1800, 0, REPEATABLE, 0x1F, true,
+					0, ALARM_RING_SECONDS };
+
+			ALARM_Store(fill - 1, &alarm, START_SECOND, &t);
+		}
+
+		start = SIM_NowNs();
+		for (uint32_t i = 0; i < calls; i++) {
+			sink += ALARM_Due(START_SECOND + (i & 1023), &t);
+		}
+		due_ns = SIM_NowNs() - start;
+
+		start = SIM_NowNs();
+		for (uint32_t i = 0; i < calls / 100; i++) {
+			ALARM_Rebuild(START_SECOND, &t, 0);
+		}
+		rebuild_ns = SIM_NowNs() - start;
+
+		printf("%-8u %12.2f %12.1f\n", fill, (double) due_ns / calls,
+				(double) rebuild_ns / (calls / 100));
+	}
+	return 0;
+}
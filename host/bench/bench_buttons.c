@@ -0,0 +1,158 @@
+/*
+ * bench_buttons.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sim.h"
+
+// The application's main loop is not run, its handlers are called directly.
+#define main humitemp_main
+#include "../../src/humitemp.c"
+#undef main
+
+// Replays random button sequences through the page table of humitemp.c the
+// way the main loop handles EVENT_BUTTON, and reports per page and edited
+// field the worst time of handle_buttons and of the render that follows.
+
+#define EVENTS_DEFAULT 50000
+// 2026-10-16 07:59:30
+#define START_SECOND   1792137570u
+// field of the time adjust or the alarm page, item of the menu
+#define SUB_STATES     16
+
+typedef struct StateStats {
+	uint32_t events;
+	uint32_t renders;
+	uint64_t handler_max;
+	uint64_t render_max;
+	uint64_t render_sum;
+} StateStats;
+
+static StateStats stats[PAGE_COUNT][SUB_STATES];
+
+static const char *const page_names[PAGE_COUNT] = { [CLOCK] = "clock",
+		[WEATHER] = "weather", [TIME_ADJUST] = "time adjust",
+		[WEATHER_ADJUST] = "weather adj", [SET_ALARM] = "alarm set",
+		[EXIT] = "exit", [MENU] = "menu" };
+
+static uint32_t xorshift(uint32_t *state) {
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return *state = x;
+}
+
+static uint32_t sub_state(void) {
+	switch (page_state) {
+	case TIME_ADJUST:
+		return date_adjust_state;
+	case SET_ALARM:
+		return alarm_adj_state;
+	case MENU:
+		return menu_selected;
+	default:
+		return 0;
+	}
+}
+
+// mostly presses, some held buttons and chords, now and then a release or a
+// long press the pages ignore
+static uint32_t random_event(uint32_t *seed) {
+	uint32_t r = xorshift(seed);
+	uint32_t buttons = (r & 1) ? BUTTON_PB1 : BUTTON_PB0;
+
+	switch ((r >> 1) % 16) {
+	case 0:
+	case 1:
+		return BUTTON_EVENT_DATA(BUTTON_CHORD, BUTTON_ALL);
+	case 2:
+	case 3:
+	case 4:
+		return BUTTON_EVENT_DATA(BUTTON_REPEAT, buttons);
+	case 5:
+		return BUTTON_EVENT_DATA(BUTTON_RELEASE, buttons);
+	case 6:
+		return BUTTON_EVENT_DATA(BUTTON_LONG_PRESS, buttons);
+	default:
+		return BUTTON_EVENT_DATA(BUTTON_PRESS, buttons);
+	}
+}
+
+int main(int argc, char **argv) {
+	uint32_t events = (argc > 1) ? strtoul(argv[1], NULL, 0) : EVENTS_DEFAULT;
+	uint32_t seed = 0x2026u;
+
+	sl_sleeptimer_init();
+	CLOCK_Init();
+	GRAPHICS_Init();
+	EVENTS_Init();
+	ALARM_Init();
+	SAMPLING_Init(SAMPLING_BASE_MS);
+	CLOCK_Set(START_SECOND);
+	CalendarSet(&calendar, CLOCK_Get(NULL));
+	CalendarSet(&adjust_calendar, stopped_at_time + offsetInSeconds);
+	tempData = temp = 21500;
+	rhData = rh = 45000;
+	resetTempHumidity();
+
+	for (uint32_t i = 0; i < events; i++) {
+		StateStats *s = &stats[page_state][sub_state()];
+		uint32_t data = random_event(&seed);
+		Event event;
+		uint64_t start;
+		uint64_t ns;
+
+		start = SIM_NowNs();
+		handle_buttons(data);
+		sync_calendars();
+		FRAME_Invalidate(FRAME_INPUT_CURSOR);
+		ns = SIM_NowNs() - start;
+		s->events++;
+		if (ns > s->handler_max) {
+			s->handler_max = ns;
+		}
+
+		s = &stats[page_state][sub_state()];
+		start = SIM_NowNs();
+		if (FRAME_Begin(page_state, pages[page_state].inputs)
+				&& pages[page_state].render != NULL) {
+			pages[page_state].render();
+			ns = SIM_NowNs() - start;
+			s->renders++;
+			s->render_sum += ns;
+			if (ns > s->render_max) {
+				s->render_max = ns;
+			}
+		}
+
+		// the measurements the weather page asks for, never taken here
+		while (EVENTS_Pop(&event)) {
+		}
+	}
+
+	printf("%-12s %5s %8s %8s %14s %14s %14s\n", "page", "field", "events",
+			"renders", "handler max ns", "render max ns", "render avg ns");
+	for (uint32_t p = 0; p < PAGE_COUNT; p++) {
+		for (uint32_t sub = 0; sub < SUB_STATES; sub++) {
+			const StateStats *s = &stats[p][sub];
+
+			if (s->events == 0 && s->renders == 0) {
+				continue;
+			}
+			printf("%-12s %5u %8u %8u %14llu %14llu %14.0f\n", page_names[p],
+					sub, s->events, s->renders,
+					(unsigned long long) s->handler_max,
+					(unsigned long long) s->render_max,
+					s->renders ? (double) s->render_sum / s->renders : 0.0);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,84 @@
+/*
+ * bench_date64.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sl_sleeptimer.h"
+#include "sl_sleeptimer_wallclock64.h"
+#include "sim.h"
+
+// Times the date conversions of the 64 bits wallclock against the 32 bits
+// ones of the SDK, both ways, on the same random timestamps within 32 bits
+// of seconds. The 32 bits ones loop over the months.
+
+#define CALLS_DEFAULT 2000000
+#define SAMPLES       4096
+
+static sl_sleeptimer_timestamp_t stamps[SAMPLES];
+static sl_sleeptimer_date_t dates[SAMPLES];
+
+int main(int argc, char **argv) {
+	uint32_t calls = (argc > 1) ? strtoul(argv[1], NULL, 0) : CALLS_DEFAULT;
+	uint32_t seed = 0x2026;
+	volatile uint32_t sink = 0;
+	uint64_t start;
+	uint64_t ns[4];
+
+	for (uint32_t i = 0; i < SAMPLES; i++) {
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+		stamps[i] = seed & INT32_MAX;
+		sl_sleeptimer_convert_time_to_date(stamps[i], 0, &dates[i]);
+	}
+
+	start = SIM_NowNs();
+	for (uint32_t i = 0; i < calls; i++) {
+		sl_sleeptimer_date_t date;
+
+		sl_sleeptimer_convert_time_to_date(stamps[i % SAMPLES], 0, &date);
+		sink += date.month_day;
+	}
+	ns[0] = SIM_NowNs() - start;
+
+	start = SIM_NowNs();
+	for (uint32_t i = 0; i < calls; i++) {
+		sl_sleeptimer_date_t date;
+
+		sl_sleeptimer_convert_time_ms64_to_date(
+				(uint64_t) stamps[i % SAMPLES] * 1000, 0, &date, NULL);
+		sink += date.month_day;
+	}
+	ns[1] = SIM_NowNs() - start;
+
+	start = SIM_NowNs();
+	for (uint32_t i = 0; i < calls; i++) {
+		sl_sleeptimer_timestamp_t time;
+
+		sl_sleeptimer_convert_date_to_time(&dates[i % SAMPLES], &time);
+		sink += time;
+	}
+	ns[2] = SIM_NowNs() - start;
+
+	start = SIM_NowNs();
+	for (uint32_t i = 0; i < calls; i++) {
+		uint64_t time_ms;
+
+		sl_sleeptimer_convert_date_to_time_ms64(&dates[i % SAMPLES], &time_ms);
+		sink += (uint32_t) time_ms;
+	}
+	ns[3] = SIM_NowNs() - start;
+
+	printf("%-14s %12s %12s\n", "conversion", "32 bits ns", "ms64 ns");
+	printf("%-14s %12.1f %12.1f\n", "time to date", (double) ns[0] / calls,
+			(double) ns[1] / calls);
+	printf("%-14s %12.1f %12.1f\n", "date to time", (double) ns[2] / calls,
+			(double) ns[3] / calls);
+	return 0;
+}
@@ -0,0 +1,145 @@
+/*
+ * bench_format.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "clock_control.h"
+#include "format.h"
+#include "sim.h"
+
+// Times each formatter of format.c against snprintf producing the same
+// string, with the value changing on every call the way a frame's readings
+// and time do. Fails if a formatter is not faster, even on the host, which
+// divides in hardware where the M0+ calls the software divide.
+
+#define CALLS_DEFAULT 2000000
+// 2026-10-16 07:59:30
+#define START_SECOND  1792137570u
+
+typedef void (*FormatFn)(char *buf, uint32_t i);
+
+typedef struct Case {
+	const char *name;
+	FormatFn format;
+	FormatFn reference;
+} Case;
+
+static Time times[64];
+
+static void two_digits(char *buf, uint32_t i) {
+	FORMAT_TwoDigits(buf, i % 100);
+}
+
+static void two_digits_printf(char *buf, uint32_t i) {
+	snprintf(buf, 16, "%02u", i % 100);
+}
+
+static void integer(char *buf, uint32_t i) {
+	FORMAT_Int(buf, (int32_t) (i * 2654435761u));
+}
+
+static void integer_printf(char *buf, uint32_t i) {
+	snprintf(buf, 16, "%d", (int32_t) (i * 2654435761u));
+}
+
+// the size of the years and min/max labels the pages draw
+static void integer_small(char *buf, uint32_t i) {
+	FORMAT_Int(buf, (int32_t) (i % 10000));
+}
+
+static void integer_small_printf(char *buf, uint32_t i) {
+	snprintf(buf, 16, "%d", (int32_t) (i % 10000));
+}
+
+static void milli1(char *buf, uint32_t i) {
+	FORMAT_Milli1(buf, (int32_t) (i & 0xFFFF) - 20000);
+}
+
+static void milli1_printf(char *buf, uint32_t i) {
+	int32_t m = (int32_t) (i & 0xFFFF) - 20000;
+	uint32_t value = (m < 0) ? (uint32_t) -m : (uint32_t) m;
+
+	snprintf(buf, 16, "%c%2u.%u", (m < 0) ? '-' : ' ', value / 1000,
+			(value / 100) % 10);
+}
+
+static void milli2(char *buf, uint32_t i) {
+	FORMAT_Milli2(buf, (int32_t) (i & 0xFFFF) - 20000);
+}
+
+static void milli2_printf(char *buf, uint32_t i) {
+	int32_t m = (int32_t) (i & 0xFFFF) - 20000;
+	uint32_t value = (m < 0) ? (uint32_t) -m : (uint32_t) m;
+
+	snprintf(buf, 16, "%s%02u.%02u", (m < 0) ? "-" : "", value / 1000,
+			(value / 10) % 100);
+}
+
+static void time_of_day(char *buf, uint32_t i) {
+	FORMAT_Time(buf, &times[i & 63]);
+}
+
+static void time_of_day_printf(char *buf, uint32_t i) {
+	const Time *t = &times[i & 63];
+
+	snprintf(buf, 16, "%02u:%02u:%02u", t->tm_hour, t->tm_min, t->tm_sec);
+}
+
+static void date(char *buf, uint32_t i) {
+	FORMAT_Date(buf, &times[i & 63]);
+}
+
+static void date_printf(char *buf, uint32_t i) {
+	const Time *t = &times[i & 63];
+
+	snprintf(buf, 16, "%02u/%02u/%d", t->tm_mday % 100, t->tm_mon % 100,
+			t->tm_year % 10000);
+}
+
+static const Case cases[] = { { "two digits", two_digits, two_digits_printf },
+		{ "int", integer, integer_printf }, { "int 0..9999", integer_small,
+				integer_small_printf }, { "milli1", milli1, milli1_printf },
+		{ "milli2", milli2, milli2_printf }, { "time", time_of_day,
+				time_of_day_printf }, { "date", date, date_printf } };
+
+static double ns_per_call(FormatFn fn, uint32_t calls) {
+	char buf[16];
+	uint64_t start = SIM_NowNs();
+	volatile char sink;
+
+	for (uint32_t i = 0; i < calls; i++) {
+		fn(buf, i);
+		sink = buf[0];
+	}
+	(void) sink;
+	return (double) (SIM_NowNs() - start) / calls;
+}
+
+int main(int argc, char **argv) {
+	uint32_t calls = (argc > 1) ? strtoul(argv[1], NULL, 0) : CALLS_DEFAULT;
+	bool slower = false;
+
+	for (uint32_t i = 0; i < 64; i++) {
+		times[i] = GetCurrTime(START_SECOND + i * 86399u);
+	}
+
+	printf("%-12s %12s %12s %8s\n", "format", "ns/call", "snprintf ns",
+			"speedup");
+	for (uint32_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+		double format_ns = ns_per_call(cases[c].format, calls);
+		double printf_ns = ns_per_call(cases[c].reference, calls);
+
+		printf("%-12s %12.2f %12.2f %7.1fx\n", cases[c].name, format_ns,
+				printf_ns, printf_ns / format_ns);
+		if (format_ns >= printf_ns) {
+			slower = true;
+		}
+	}
+	return slower;
+}
@@ -0,0 +1,105 @@
+/*
+ * bench_glyph.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "em_types.h"
+#include "dmd.h"
+#include "glib.h"
+#include "extra_fonts.h"
+#include "glyph.h"
+#include "sim.h"
+
+// Glyphs per second of GLYPH_DrawString through GLIB (one rectangle per run
+// of pixels) and through the frame buffer, for the fonts and scales the
+// pages draw, at an x on a byte boundary and off it. At scale 1 GLIB's own
+// GLIB_drawString, which plots pixel by pixel, is timed too: that is how all
+// text was drawn before.
+
+#define STRINGS_DEFAULT 50000
+#define TEXT            "12:34:56"
+#define TEXT_LEN        8
+
+typedef struct Case {
+	const char *name;
+	const GLIB_Font_t *font;
+	uint32_t scale;
+	int32_t x;
+	bool opaque;
+} Case;
+
+static const Case cases[] = { { "7seg x2", &GLIB_font7Segment, 2, 8, true },
+		{ "7seg x2", &GLIB_font7Segment, 2, 3, true }, { "7seg x1",
+				&GLIB_font7Segment, 1, 8, false }, { "custom x1",
+				&GLIB_fontCustom, 1, 8, true }, { "custom x1", &GLIB_fontCustom,
+				1, 5, false }, { "custom x2", &GLIB_fontCustom, 2, 0, true }, {
+				"custom x3", &GLIB_fontCustom, 3, 0, false } };
+
+// glyph.c takes the frame buffer from here, NULL draws through GLIB
+static bool frame_path;
+
+uint8_t *LCD_GetFrame(void) {
+	return frame_path ? SIM_DmdFrame() : NULL;
+}
+
+static double glyphs_per_s(GLIB_Context_t *context, const Case *c,
+		uint32_t strings, int path) {
+	uint64_t start = SIM_NowNs();
+	uint64_t ns;
+
+	frame_path = (path == 2);
+	for (uint32_t i = 0; i < strings; i++) {
+		int32_t y = (i * 8) & 63;
+
+		if (path == 0) {
+			GLIB_drawString(context, TEXT, TEXT_LEN, c->x, y, c->opaque);
+		} else {
+			GLYPH_DrawString(context, TEXT, TEXT_LEN, c->x, y, c->scale,
+					c->opaque);
+		}
+	}
+	ns = SIM_NowNs() - start;
+	return (double) strings * TEXT_LEN * 1e9 / ns;
+}
+
+int main(int argc, char **argv) {
+	uint32_t strings = (argc > 1) ? strtoul(argv[1], NULL, 0) : STRINGS_DEFAULT;
+	GLIB_Context_t context;
+
+	DMD_init(NULL);
+	GLIB_contextInit(&context);
+	context.foregroundColor = White;
+	context.backgroundColor = Black;
+
+	printf("%-10s %3s %7s %14s %14s %14s %8s\n", "font", "x", "opaque",
+			"drawString/s", "GLIB runs/s", "frame/s", "speedup");
+	for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+		const Case *c = &cases[i];
+		double before = 0;
+		double runs;
+		double frame;
+
+		GLIB_setFont(&context, (GLIB_Font_t*) c->font);
+		if (c->scale == 1) {
+			before = glyphs_per_s(&context, c, strings, 0);
+		}
+		runs = glyphs_per_s(&context, c, strings, 1);
+		frame = glyphs_per_s(&context, c, strings, 2);
+
+		if (c->scale == 1) {
+			printf("%-10s %3d %7s %14.0f %14.0f %14.0f %7.1fx\n", c->name,
+					c->x, c->opaque ? "yes" : "no", before, runs, frame,
+					frame / before);
+		} else {
+			printf("%-10s %3d %7s %14s %14.0f %14.0f %7.1fx\n", c->name, c->x,
+					c->opaque ? "yes" : "no", "-", runs, frame, frame / runs);
+		}
+	}
+	return 0;
+}
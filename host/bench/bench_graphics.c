@@ -0,0 +1,121 @@
+/*
+ * bench_graphics.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "clock_control.h"
+#include "graphics.h"
+#include "lcd_flush.h"
+#include "sim.h"
+
+// the weather page state is private to graphics.c
+#include "../../src/graphics.c"
+
+// Renders every page for a number of frames with its inputs changing the way
+// they do on the device, and reports the time per frame, the pixels GLIB
+// plotted and the panel pixels and lines the flush changed. "weather full"
+// renders the weather page the way it was before the thermometer sprites:
+// the whole page, thermometers from GLIB primitives, every frame.
+
+#define FRAMES_DEFAULT 5000
+// 2026-10-16 07:59:30
+#define START_SECOND   1792137570u
+
+typedef void (*RenderFn)(uint32_t frame);
+
+typedef struct Page {
+	const char *name;
+	RenderFn render;
+} Page;
+
+static void render_clock(uint32_t frame) {
+	Time t = GetCurrTime(START_SECOND + frame);
+
+	GRAPHICS_Draw_Clock(21500 + (frame / 30) * 10, 45000, &t, true,
+			(frame / 60) & 1, false);
+}
+
+static void render_weather(uint32_t frame) {
+	// a new sample every 2 s, a new min/max now and then
+	int32_t temp = 21500 + ((frame / 2) % 40) * 25;
+	int32_t rh = 45000 + ((frame / 2) % 25) * 100;
+
+	GRAPHICS_Draw_Weather_Station(temp, rh, false, 18000,
+			25000 + (frame / 500) * 100, 30000, 60000, false);
+}
+
+static void render_weather_full(uint32_t frame) {
+	weatherOnScreen = false;
+	thermometerSpriteValid = false;
+	render_weather(frame);
+	thermometerSpriteValid = true;
+}
+
+static void render_time_adj(uint32_t frame) {
+	Time t = GetCurrTime(START_SECOND);
+
+	GRPAHICS_DrawTimeAdj((frame / 8) % 8, &t, frame & 1, false);
+}
+
+static void render_alarm_set(uint32_t frame) {
+	Alarm alarm = { 7 * 3600 + 30 * 60, 0, REPEATABLE, 0x1F, true, 0,
+			60 };
+
+	GRAPHICS_DrawAlarmSet(frame % 16, &alarm, (frame / 8) % 13, frame & 1,
+			false);
+}
+
+static void render_menu(uint32_t frame) {
+	GRAPHICS_DrawMenu((frame / 4) % 6, false);
+}
+
+static const Page pages[] = { { "clock", render_clock }, { "weather",
+		render_weather }, { "weather full", render_weather_full }, {
+		"time adjust", render_time_adj }, { "alarm set", render_alarm_set }, {
+		"menu", render_menu } };
+
+int main(int argc, char **argv) {
+	uint32_t frames = (argc > 1) ? strtoul(argv[1], NULL, 0) : FRAMES_DEFAULT;
+	double weather_ns = 0;
+	double weather_full_ns = 0;
+
+	GRAPHICS_Init();
+
+	printf("%-12s %8s %12s %12s %12s %10s\n", "page", "frames", "ns/frame",
+			"plotted/fr", "changed/fr", "lines/fr");
+	for (uint32_t p = 0; p < sizeof(pages) / sizeof(pages[0]); p++) {
+		SimDisplayStats stats;
+		uint64_t start;
+		uint64_t ns;
+
+		// one frame to switch to the page, not counted
+		pages[p].render(0);
+		SIM_DisplayResetStats();
+
+		start = SIM_NowNs();
+		for (uint32_t frame = 1; frame <= frames; frame++) {
+			pages[p].render(frame);
+		}
+		ns = SIM_NowNs() - start;
+		stats = SIM_DisplayGetStats();
+
+		if (pages[p].render == render_weather) {
+			weather_ns = (double) ns / frames;
+		} else if (pages[p].render == render_weather_full) {
+			weather_full_ns = (double) ns / frames;
+		}
+		printf("%-12s %8u %12.0f %12.1f %12.1f %10.1f\n", pages[p].name,
+				frames, (double) ns / frames, (double) stats.plotted / frames,
+				(double) stats.changed / frames, (double) stats.lines / frames);
+	}
+	printf("weather page %.1fx faster than the full redraw\n",
+			weather_full_ns / weather_ns);
+	// the sprites and the mercury-only frames are there for a tenfold drop
+	return (weather_full_ns < 10 * weather_ns);
+}
@@ -0,0 +1,227 @@
+/*
+ * bench_scale.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sim.h"
+
+// pixel_scale() and the thermometer rows are private to graphics.c
+#include "../../src/graphics.c"
+
+// Maps every min/max/level combination of whole degrees from -60 to 130 to
+// the mercury row of a weather page thermometer, with pixel_scale() and
+// scale_to_pixels() and with the float code they replaced, and times both.
+// The host has an FPU, the M0+ has not: the float code is also run on a
+// software single precision that rounds like the libgcc routines it called,
+// which is what its cost on the device looks like. The fixed-point rows must
+// equal floor(value * span / range) everywhere; the float ones may land a
+// pixel short where the product fell just below an integer.
+
+#define DEGREE_MIN -60
+#define DEGREE_MAX 130
+#define REPEATS_DEFAULT 20
+
+typedef struct Combo {
+	int32_t min;
+	int32_t max;
+	int32_t level;
+} Combo;
+
+/* IEEE single precision bits, only for the finite, non-negative values the
+ * thermometer produces; rounded to nearest, ties to even */
+typedef uint32_t SoftFloat;
+
+// m * 2^e, m not 0
+static SoftFloat soft_round(uint64_t m, int32_t e) {
+	int32_t top = 63 - __builtin_clzll(m);
+
+	if (top > 23) {
+		uint32_t sh = top - 23;
+		uint64_t rest = m & ((1ull << sh) - 1);
+		uint64_t half = 1ull << (sh - 1);
+
+		m >>= sh;
+		e += sh;
+		if (rest > half || (rest == half && (m & 1))) {
+			m++;
+			if (m >> 24) {
+				m >>= 1;
+				e++;
+			}
+		}
+	} else {
+		m <<= 23 - top;
+		e -= 23 - top;
+	}
+	return ((uint32_t) (e + 23 + 127) << 23) | ((uint32_t) m & 0x7FFFFF);
+}
+
+static uint32_t soft_mantissa(SoftFloat f) {
+	return (f & 0x7FFFFF) | 0x800000;
+}
+
+static int32_t soft_exponent(SoftFloat f) {
+	return (int32_t) (f >> 23) - 127;
+}
+
+static SoftFloat soft_from_uint(uint32_t v) {
+	return (v == 0) ? 0 : soft_round(v, 0);
+}
+
+static SoftFloat soft_mul(SoftFloat a, SoftFloat b) {
+	if (a == 0 || b == 0) {
+		return 0;
+	}
+	return soft_round((uint64_t) soft_mantissa(a) * soft_mantissa(b),
+			soft_exponent(a) + soft_exponent(b) - 46);
+}
+
+static SoftFloat soft_div(SoftFloat a, SoftFloat b) {
+	uint64_t n;
+	uint64_t q;
+
+	if (a == 0) {
+		return 0;
+	}
+	// 40 more quotient bits than needed, the remainder as a sticky bit
+	n = (uint64_t) soft_mantissa(a) << 40;
+	q = n / soft_mantissa(b);
+	return soft_round((q << 1) | (n % soft_mantissa(b) != 0),
+			soft_exponent(a) - soft_exponent(b) - 41);
+}
+
+// truncates, as the cast to uint32_t does
+static uint32_t soft_to_uint(SoftFloat f) {
+	int32_t e = soft_exponent(f);
+
+	if (f == 0 || e < 0) {
+		return 0;
+	}
+	return (e <= 23) ?
+			soft_mantissa(f) >> (23 - e) : soft_mantissa(f) << (e - 23);
+}
+
+static uint32_t clamp_level(const Combo *c) {
+	int32_t level = c->level;
+
+	if (level < c->min)
+		level = c->min;
+	if (level > c->max)
+		level = c->max;
+	return (uint32_t) level;
+}
+
+static uint32_t row_fixed(const Combo *c) {
+	uint32_t level = clamp_level(c);
+
+	return THERMO_BOTTOM_ROW
+			- scale_to_pixels(
+					pixel_scale((uint32_t) c->max - (uint32_t) c->min,
+							THERMO_BOTTOM_ROW - THERMO_TOP_ROW),
+					level - (uint32_t) c->min);
+}
+
+// the weather page before fixed point
+static uint32_t row_float(const Combo *c) {
+	int32_t level = clamp_level(c);
+	float valueRatio = 0.0f;
+
+	if ((c->max - c->min) != 0) {
+		valueRatio = (float) (level - c->min) / (float) (c->max - c->min);
+	}
+	return THERMO_BOTTOM_ROW
+			- (uint32_t) (valueRatio
+					* (float) (THERMO_BOTTOM_ROW - THERMO_TOP_ROW));
+}
+
+static uint32_t row_soft_float(const Combo *c) {
+	int32_t level = clamp_level(c);
+	SoftFloat valueRatio = 0;
+
+	if ((c->max - c->min) != 0) {
+		valueRatio = soft_div(soft_from_uint(level - c->min),
+				soft_from_uint(c->max - c->min));
+	}
+	return THERMO_BOTTOM_ROW
+			- soft_to_uint(
+					soft_mul(valueRatio,
+							soft_from_uint(THERMO_BOTTOM_ROW - THERMO_TOP_ROW)));
+}
+
+static uint32_t row_exact(const Combo *c) {
+	uint32_t range = c->max - c->min;
+
+	if (range == 0) {
+		return THERMO_BOTTOM_ROW;
+	}
+	return THERMO_BOTTOM_ROW
+			- (uint32_t) ((uint64_t) (clamp_level(c) - c->min)
+					* (THERMO_BOTTOM_ROW - THERMO_TOP_ROW) / range);
+}
+
+static double ns_per_row(uint32_t (*row)(const Combo*), const Combo *combos,
+		uint32_t count, uint32_t repeats) {
+	uint64_t start = SIM_NowNs();
+	volatile uint32_t sink = 0;
+
+	for (uint32_t r = 0; r < repeats; r++) {
+		for (uint32_t i = 0; i < count; i++) {
+			sink += row(&combos[i]);
+		}
+	}
+	(void) sink;
+	return (double) (SIM_NowNs() - start) / ((double) count * repeats);
+}
+
+int main(int argc, char **argv) {
+	uint32_t repeats = (argc > 1) ? strtoul(argv[1], NULL, 0) : REPEATS_DEFAULT;
+	uint32_t span = DEGREE_MAX - DEGREE_MIN + 1;
+	Combo *combos = malloc(sizeof(Combo) * span * (span + 1) * (span + 2) / 6);
+	uint32_t count = 0;
+	uint32_t fixed_wrong = 0;
+	uint32_t float_short = 0;
+	uint32_t float_other = 0;
+	uint32_t soft_wrong = 0;
+
+	for (int32_t min = DEGREE_MIN; min <= DEGREE_MAX; min++) {
+		for (int32_t max = min; max <= DEGREE_MAX; max++) {
+			for (int32_t level = min; level <= max; level++) {
+				combos[count++] = (Combo ) { min, max, level };
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t exact = row_exact(&combos[i]);
+		uint32_t by_float = row_float(&combos[i]);
+
+		fixed_wrong += (row_fixed(&combos[i]) != exact);
+		soft_wrong += (row_soft_float(&combos[i]) != by_float);
+		if (by_float == exact + 1) {
+			float_short++;
+		} else if (by_float != exact) {
+			float_other++;
+		}
+	}
+	printf("%u combinations: fixed point %u off the exact row, float %u a"
+			" pixel short and %u otherwise off, soft float %u off the float"
+			" rows\n", count, fixed_wrong, float_short, float_other,
+			soft_wrong);
+
+	printf("%-16s %10s\n", "mapping", "ns/row");
+	printf("%-16s %10.2f\n", "fixed point",
+			ns_per_row(row_fixed, combos, count, repeats));
+	printf("%-16s %10.2f\n", "float (FPU)",
+			ns_per_row(row_float, combos, count, repeats));
+	printf("%-16s %10.2f\n", "float (software)",
+			ns_per_row(row_soft_float, combos, count, repeats));
+
+	free(combos);
+	return (fixed_wrong != 0 || float_other != 0 || soft_wrong != 0);
+}
@@ -0,0 +1,120 @@
+/*
+ * bench_timers.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sl_sleeptimer.h"
+#include "sl_sleeptimer_hal_sim.h"
+#include "sim.h"
+
+// Times the sleeptimer with 4, 32 and 256 running timers: starting them,
+// restarting a running one, and serving expiries of periodic timers on the
+// simulated RTC. Built against both timer stores, bench_timers for the delta
+// list and bench_timers_wheel for the timing wheel.
+
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+#define STORE_NAME "wheel"
+#else
+#define STORE_NAME "delta list"
+#endif
+
+#define TIMERS_MAX       256
+#define RESTARTS_DEFAULT 20000
+// one-shot timeouts up to a minute, periods up to a second
+#define TIMEOUT_MAX      (60u * 32768u)
+#define PERIOD_MIN       100u
+#define PERIOD_MAX       32768u
+#define EXPIRIES_MIN     100000u
+#define FILLS            4096u
+
+static const uint32_t timer_counts[] = { 4, 32, 256 };
+
+static sl_sleeptimer_timer_handle_t timers[TIMERS_MAX];
+static uint32_t expiries;
+
+static uint32_t xorshift(uint32_t *state) {
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return *state = x;
+}
+
+static void expired(sl_sleeptimer_timer_handle_t *handle, void *data) {
+	(void) handle;
+	(void) data;
+	expiries++;
+}
+
+static void stop_all(uint32_t count) {
+	for (uint32_t i = 0; i < count; i++) {
+		sl_sleeptimer_stop_timer(&timers[i]);
+	}
+}
+
+int main(int argc, char **argv) {
+	uint32_t restarts = (argc > 1) ? strtoul(argv[1], NULL, 0) : RESTARTS_DEFAULT;
+	uint32_t seed = 0x5EED;
+
+	sl_sleeptimer_init();
+
+	printf("%-10s %6s %10s %12s %12s\n", "store", "timers", "start ns",
+			"restart ns", "expiry ns");
+	for (uint32_t c = 0; c < sizeof(timer_counts) / sizeof(timer_counts[0]);
+			c++) {
+		uint32_t count = timer_counts[c];
+		uint64_t start;
+		uint64_t start_ns;
+		uint64_t restart_ns;
+		uint64_t expiry_ns;
+
+		// fill the store from empty, a few thousand starts in all
+		start_ns = 0;
+		for (uint32_t round = 0; round < FILLS / count; round++) {
+			if (round > 0) {
+				stop_all(count);
+			}
+			start = SIM_NowNs();
+			for (uint32_t i = 0; i < count; i++) {
+				sl_sleeptimer_start_timer(&timers[i],
+						1 + xorshift(&seed) % TIMEOUT_MAX, expired, NULL,
+						xorshift(&seed) & 3, 0);
+			}
+			start_ns += SIM_NowNs() - start;
+		}
+
+		start = SIM_NowNs();
+		for (uint32_t i = 0; i < restarts; i++) {
+			sl_sleeptimer_restart_timer(&timers[xorshift(&seed) % count],
+					1 + xorshift(&seed) % TIMEOUT_MAX, expired, NULL,
+					xorshift(&seed) & 3, 0);
+		}
+		restart_ns = SIM_NowNs() - start;
+		stop_all(count);
+
+		for (uint32_t i = 0; i < count; i++) {
+			sl_sleeptimer_start_periodic_timer(&timers[i],
+					PERIOD_MIN + xorshift(&seed) % (PERIOD_MAX - PERIOD_MIN),
+					expired, NULL, xorshift(&seed) & 3, 0);
+		}
+		expiries = 0;
+		start = SIM_NowNs();
+		while (expiries < EXPIRIES_MIN) {
+			sl_sleeptimer_hal_sim_advance(PERIOD_MAX);
+		}
+		expiry_ns = SIM_NowNs() - start;
+		stop_all(count);
+
+		printf("%-10s %6u %10.0f %12.0f %12.0f\n", STORE_NAME, count,
+				(double) start_ns / (FILLS / count * count), (double) restart_ns / restarts,
+				(double) expiry_ns / expiries);
+	}
+	return 0;
+}
@@ -0,0 +1,111 @@
+/*
+ * display_sim.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "em_types.h"
+#include "display.h"
+#include "dmd.h"
+#include "sim.h"
+
+// Headless 128x128 memory LCD. The panel keeps what the last transfers put
+// there, so the tests can read back what the device would show.
+
+static uint8_t panel[SIM_PANEL_HEIGHT][SIM_PANEL_ROW_BYTES];
+static uint8_t dmd_frame[SIM_PANEL_HEIGHT][SIM_PANEL_ROW_BYTES];
+static uint8_t *frame = &dmd_frame[0][0];
+static bool dmd_ready = false;
+static DMD_DisplayGeometry geometry = { SIM_PANEL_WIDTH, SIM_PANEL_HEIGHT, 0,
+		0, SIM_PANEL_WIDTH, SIM_PANEL_HEIGHT };
+static SimDisplayStats stats;
+
+/***************************************************************************//**
+ * @brief Copies whole lines to the panel, like the memory LCD driver the
+ *        lines must start at column 0 and span the width.
+ ******************************************************************************/
+static EMSTATUS pixel_matrix_draw(DISPLAY_Device_t *device, void *pixelMatrix,
+		unsigned int startColumn, unsigned int width, unsigned int startRow,
+		unsigned int height) {
+	const uint8_t *src = pixelMatrix;
+
+	(void) device;
+	if (startColumn != 0 || width != SIM_PANEL_WIDTH
+			|| startRow + height > SIM_PANEL_HEIGHT) {
+		return DISPLAY_EMSTATUS_INVALID_PARAMETER;
+	}
+	for (unsigned int row = startRow; row < startRow + height; row++) {
+		for (unsigned int b = 0; b < SIM_PANEL_ROW_BYTES; b++) {
+			stats.changed += __builtin_popcount(panel[row][b] ^ *src);
+			panel[row][b] = *src++;
+		}
+	}
+	stats.lines += height;
+	return DISPLAY_EMSTATUS_OK;
+}
+
+EMSTATUS DISPLAY_Init(void) {
+	return DISPLAY_EMSTATUS_OK;
+}
+
+EMSTATUS DISPLAY_DeviceGet(int displayDeviceNo, DISPLAY_Device_t *device) {
+	if (displayDeviceNo != 0) {
+		return DISPLAY_EMSTATUS_INVALID_PARAMETER;
+	}
+	memset(device, 0, sizeof(*device));
+	device->name = "Sim Memory LCD";
+	device->geometry.width = SIM_PANEL_WIDTH;
+	device->geometry.height = SIM_PANEL_HEIGHT;
+	device->geometry.stride = SIM_PANEL_WIDTH;
+	device->pPixelMatrixDraw = pixel_matrix_draw;
+	return DISPLAY_EMSTATUS_OK;
+}
+
+EMSTATUS DMD_init(void *initData) {
+	(void) initData;
+	frame = &dmd_frame[0][0];
+	dmd_ready = true;
+	return DMD_OK;
+}
+
+EMSTATUS DMD_getDisplayGeometry(DMD_DisplayGeometry **pGeometry) {
+	if (!dmd_ready) {
+		return DMD_ERROR_DRIVER_NOT_INITIALIZED;
+	}
+	*pGeometry = &geometry;
+	return DMD_OK;
+}
+
+EMSTATUS DMD_selectFramebuffer(void *framebuffer) {
+	frame = (framebuffer != NULL) ? framebuffer : &dmd_frame[0][0];
+	return DMD_OK;
+}
+
+EMSTATUS DMD_updateDisplay(void) {
+	return pixel_matrix_draw(NULL, frame, 0, SIM_PANEL_WIDTH, 0,
+			SIM_PANEL_HEIGHT);
+}
+
+uint8_t *SIM_DmdFrame(void) {
+	return frame;
+}
+
+void SIM_DmdCountPlotted(uint32_t pixels) {
+	stats.plotted += pixels;
+}
+
+const uint8_t *SIM_DisplayPanel(void) {
+	return &panel[0][0];
+}
+
+SimDisplayStats SIM_DisplayGetStats(void) {
+	return stats;
+}
+
+void SIM_DisplayResetStats(void) {
+	memset(&stats, 0, sizeof(stats));
+}
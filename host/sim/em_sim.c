@@ -0,0 +1,120 @@
+/*
+ * em_sim.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "em_device.h"
+#include "em_emu.h"
+#include "em_gpio.h"
+#include "em_adc.h"
+#include "sim.h"
+
+#define GPIO_PORTS 6
+
+I2C_TypeDef SIM_I2C0;
+ADC_TypeDef SIM_ADC0;
+
+static uint16_t gpio_levels[GPIO_PORTS] = { 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+		0xFFFF, 0xFFFF };
+static uint32_t gpio_flags;
+static uint32_t adc_flags;
+
+static void idle_abort(void) {
+	fprintf(stderr, "sim: sleeping with nothing to wake up\n");
+	abort();
+}
+
+static void (*idle_hook)(void) = idle_abort;
+
+void SIM_SetIdleHook(void (*hook)(void)) {
+	idle_hook = (hook != NULL) ? hook : idle_abort;
+}
+
+void EMU_EnterEM1(void) {
+	idle_hook();
+}
+
+void EMU_EnterEM2(bool restore) {
+	(void) restore;
+	idle_hook();
+}
+
+void SIM_GpioSetPin(unsigned int port, unsigned int pin, bool level) {
+	uint16_t bit = 1u << pin;
+
+	if (((gpio_levels[port] & bit) != 0) != level) {
+		gpio_levels[port] ^= bit;
+		gpio_flags |= bit;
+	}
+}
+
+void GPIO_PinModeSet(GPIO_Port_TypeDef port, unsigned int pin,
+		GPIO_Mode_TypeDef mode, unsigned int out) {
+	(void) port;
+	(void) pin;
+	(void) mode;
+	(void) out;
+}
+
+unsigned int GPIO_PinInGet(GPIO_Port_TypeDef port, unsigned int pin) {
+	return (gpio_levels[port] >> pin) & 1;
+}
+
+void GPIO_IntConfig(GPIO_Port_TypeDef port, unsigned int pin,
+		bool risingEdge, bool fallingEdge, bool enable) {
+	(void) port;
+	(void) pin;
+	(void) risingEdge;
+	(void) fallingEdge;
+	(void) enable;
+}
+
+uint32_t GPIO_IntGet(void) {
+	return gpio_flags;
+}
+
+void GPIO_IntClear(uint32_t flags) {
+	gpio_flags &= ~flags;
+}
+
+void ADC_Init(ADC_TypeDef *adc, const ADC_Init_TypeDef *init) {
+	(void) adc;
+	(void) init;
+}
+
+void ADC_InitSingle(ADC_TypeDef *adc, const ADC_InitSingle_TypeDef *init) {
+	(void) adc;
+	(void) init;
+}
+
+void ADC_IntEnable(ADC_TypeDef *adc, uint32_t flags) {
+	(void) adc;
+	(void) flags;
+}
+
+uint32_t ADC_IntGet(ADC_TypeDef *adc) {
+	(void) adc;
+	return adc_flags;
+}
+
+void ADC_IntClear(ADC_TypeDef *adc, uint32_t flags) {
+	(void) adc;
+	adc_flags &= ~flags;
+}
+
+void ADC_Start(ADC_TypeDef *adc, ADC_Start_TypeDef cmd) {
+	(void) adc;
+	(void) cmd;
+	adc_flags |= ADC_IEN_SINGLE;
+}
+
+uint32_t ADC_DataSingleGet(ADC_TypeDef *adc) {
+	(void) adc;
+	return SIM_ADC_RESULT;
+}
@@ -0,0 +1,28 @@
+/*
+ * glib_fonts.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+
+#include "glib.h"
+
+// Stand-ins for the SDK fonts with their metrics. Both use the glyphs of
+// src/font_custom.c, the narrow one cut to its 6 leftmost columns.
+
+static const uint8_t font8x8[] = {0x00,0x18,0x36,0x36,0x0C,0x00,0x1C,0x06,0x18,0x06,0x00,0x00,0x00,0x00,0x00,0x60,0x3E,0x0C,0x1E,0x1E,0x38,0x3F,0x1C,0x3F,0x1E,0x1E,0x00,0x00,0x18,0x00,0x06,0x1E,0x3E,0x0C,0x3F,0x3C,0x1F,0x7F,0x7F,0x3C,0x33,0x1E,0x78,0x67,0x0F,0x63,0x63,0x1C,0x3F,0x1E,0x3F,0x1E,0x3F,0x33,0x33,0x63,0x63,0x33,0x7F,0x1E,0x03,0x1E,0x08,0x00,0x0C,0x00,0x07,0x00,0x38,0x00,0x1C,0x00,0x07,0x0C,0x30,0x07,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x18,0x07,0x6E,0x00,
+		0x00,0x3C,0x36,0x36,0x3E,0x63,0x36,0x06,0x0C,0x0C,0x66,0x0C,0x00,0x00,0x00,0x30,0x63,0x0E,0x33,0x33,0x3C,0x03,0x06,0x33,0x33,0x33,0x0C,0x0C,0x0C,0x00,0x0C,0x33,0x63,0x1E,0x66,0x66,0x36,0x46,0x46,0x66,0x33,0x0C,0x30,0x66,0x06,0x77,0x67,0x36,0x66,0x33,0x66,0x33,0x2D,0x33,0x33,0x63,0x63,0x33,0x63,0x06,0x06,0x18,0x1C,0x00,0x0C,0x00,0x06,0x00,0x30,0x00,0x36,0x00,0x06,0x00,0x00,0x06,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x18,0x0C,0x3B,0x00,
+		0x00,0x3C,0x00,0x7F,0x03,0x33,0x1C,0x03,0x06,0x18,0x3C,0x0C,0x00,0x00,0x00,0x18,0x73,0x0C,0x30,0x30,0x36,0x1F,0x03,0x30,0x33,0x33,0x0C,0x0C,0x06,0x3F,0x18,0x30,0x7B,0x33,0x66,0x03,0x66,0x16,0x16,0x03,0x33,0x0C,0x30,0x36,0x06,0x7F,0x6F,0x63,0x66,0x33,0x66,0x07,0x0C,0x33,0x33,0x63,0x36,0x33,0x31,0x06,0x0C,0x18,0x36,0x00,0x18,0x1E,0x06,0x1E,0x30,0x1E,0x06,0x6E,0x36,0x0E,0x30,0x66,0x0C,0x33,0x1F,0x1E,0x3B,0x6E,0x3B,0x3E,0x3E,0x33,0x33,0x63,0x63,0x33,0x3F,0x0C,0x18,0x0C,0x00,0x00,
+		0x00,0x18,0x00,0x36,0x1E,0x18,0x6E,0x00,0x06,0x18,0xFF,0x3F,0x00,0x3F,0x00,0x0C,0x7B,0x0C,0x1C,0x1C,0x33,0x30,0x1F,0x18,0x1E,0x3E,0x00,0x00,0x03,0x00,0x30,0x18,0x7B,0x33,0x3E,0x03,0x66,0x1E,0x1E,0x03,0x3F,0x0C,0x30,0x1E,0x06,0x7F,0x7B,0x63,0x3E,0x33,0x3E,0x0E,0x0C,0x33,0x33,0x6B,0x1C,0x1E,0x18,0x06,0x18,0x18,0x63,0x00,0x00,0x30,0x3E,0x33,0x3E,0x33,0x0F,0x33,0x6E,0x0C,0x30,0x36,0x0C,0x7F,0x33,0x33,0x66,0x33,0x6E,0x03,0x0C,0x33,0x33,0x6B,0x36,0x33,0x19,0x07,0x00,0x38,0x00,0x00,
+		0x00,0x18,0x00,0x7F,0x30,0x0C,0x3B,0x00,0x06,0x18,0x3C,0x0C,0x00,0x00,0x00,0x06,0x6F,0x0C,0x06,0x30,0x7F,0x30,0x33,0x0C,0x33,0x30,0x00,0x00,0x06,0x00,0x18,0x0C,0x7B,0x3F,0x66,0x03,0x66,0x16,0x16,0x73,0x33,0x0C,0x33,0x36,0x46,0x6B,0x73,0x63,0x06,0x3B,0x36,0x38,0x0C,0x33,0x33,0x7F,0x1C,0x0C,0x4C,0x06,0x30,0x18,0x00,0x00,0x00,0x3E,0x66,0x03,0x33,0x3F,0x06,0x33,0x66,0x0C,0x30,0x1E,0x0C,0x7F,0x33,0x33,0x66,0x33,0x66,0x1E,0x0C,0x33,0x33,0x7F,0x1C,0x33,0x0C,0x0C,0x18,0x0C,0x00,0x00,
+		0x00,0x00,0x00,0x36,0x1F,0x66,0x33,0x00,0x0C,0x0C,0x66,0x0C,0x0C,0x00,0x0C,0x03,0x67,0x0C,0x33,0x33,0x30,0x33,0x33,0x0C,0x33,0x18,0x0C,0x0C,0x0C,0x3F,0x0C,0x00,0x03,0x33,0x66,0x66,0x36,0x46,0x06,0x66,0x33,0x0C,0x33,0x66,0x66,0x63,0x63,0x36,0x06,0x1E,0x66,0x33,0x0C,0x33,0x1E,0x77,0x36,0x0C,0x66,0x06,0x60,0x18,0x00,0x00,0x00,0x33,0x66,0x33,0x33,0x03,0x06,0x3E,0x66,0x0C,0x33,0x36,0x0C,0x6B,0x33,0x33,0x3E,0x3E,0x06,0x30,0x2C,0x33,0x1E,0x7F,0x36,0x3E,0x26,0x0C,0x18,0x0C,0x00,0x00,
+		0x00,0x18,0x00,0x36,0x0C,0x63,0x6E,0x00,0x18,0x06,0x00,0x00,0x0C,0x00,0x0C,0x01,0x3E,0x3F,0x3F,0x1E,0x78,0x1E,0x1E,0x0C,0x1E,0x0E,0x0C,0x0C,0x18,0x00,0x06,0x0C,0x1E,0x33,0x3F,0x3C,0x1F,0x7F,0x0F,0x7C,0x33,0x1E,0x1E,0x67,0x7F,0x63,0x63,0x1C,0x0F,0x38,0x67,0x1E,0x1E,0x3F,0x0C,0x63,0x63,0x1E,0x7F,0x1E,0x40,0x1E,0x00,0x00,0x00,0x6E,0x3B,0x1E,0x6E,0x1E,0x0F,0x30,0x67,0x1E,0x33,0x67,0x1E,0x63,0x33,0x1E,0x06,0x30,0x0F,0x1F,0x18,0x6E,0x0C,0x36,0x63,0x30,0x3F,0x38,0x18,0x07,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x0F,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x00
+		};
+
+const GLIB_Font_t GLIB_FontNarrow6x8 = { (void *) font8x8, sizeof(font8x8),
+		sizeof(font8x8[0]), 96, 6, 8, 0, 0, FullFont };
+
+const GLIB_Font_t GLIB_FontNormal8x8 = { (void *) font8x8, sizeof(font8x8),
+		sizeof(font8x8[0]), 96, 8, 8, 0, 0, FullFont };
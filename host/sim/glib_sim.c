@@ -0,0 +1,225 @@
+/*
+ * glib_sim.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "em_types.h"
+#include "dmd.h"
+#include "glib.h"
+#include "sim.h"
+
+// The GLIB primitives the sources use, drawn pixel by pixel into the DMD
+// frame buffer in the format lcd_flush.c transmits: 1 bit per pixel, bit 0
+// leftmost, set for any colour but black. Every pixel inside the clipping
+// region counts as plotted, as it would be a DMD write on the device.
+
+static void plot_span(const GLIB_Context_t *pContext, int32_t x1, int32_t x2,
+		int32_t y, uint32_t color) {
+	const GLIB_Rectangle_t *clip = &pContext->clippingRegion;
+	uint8_t *line = SIM_DmdFrame() + y * SIM_PANEL_ROW_BYTES;
+
+	if (y < clip->yMin || y > clip->yMax || y < 0 || y >= SIM_PANEL_HEIGHT) {
+		return;
+	}
+	if (x1 < clip->xMin) {
+		x1 = clip->xMin;
+	}
+	if (x1 < 0) {
+		x1 = 0;
+	}
+	if (x2 > clip->xMax) {
+		x2 = clip->xMax;
+	}
+	if (x2 >= SIM_PANEL_WIDTH) {
+		x2 = SIM_PANEL_WIDTH - 1;
+	}
+	for (int32_t x = x1; x <= x2; x++) {
+		uint8_t bit = 1u << (x & 7);
+
+		if (color != Black) {
+			line[x >> 3] |= bit;
+		} else {
+			line[x >> 3] &= ~bit;
+		}
+	}
+	if (x2 >= x1) {
+		SIM_DmdCountPlotted(x2 - x1 + 1);
+	}
+}
+
+static uint32_t font_row(const GLIB_Font_t *font, uint32_t index) {
+	switch (font->sizeOfMapElement) {
+	case 1:
+		return ((const uint8_t *) font->pFontPixMap)[index];
+	case 2:
+		return ((const uint16_t *) font->pFontPixMap)[index];
+	default:
+		return ((const uint32_t *) font->pFontPixMap)[index];
+	}
+}
+
+EMSTATUS GLIB_contextInit(GLIB_Context_t *pContext) {
+	EMSTATUS status;
+
+	if (pContext == NULL) {
+		return GLIB_ERROR_INVALID_ARGUMENT;
+	}
+	status = DMD_getDisplayGeometry(&pContext->pDisplayGeometry);
+	if (status != DMD_OK) {
+		return status;
+	}
+	pContext->backgroundColor = White;
+	pContext->foregroundColor = Black;
+	pContext->clippingRegion.xMin = 0;
+	pContext->clippingRegion.yMin = 0;
+	pContext->clippingRegion.xMax = pContext->pDisplayGeometry->xSize - 1;
+	pContext->clippingRegion.yMax = pContext->pDisplayGeometry->ySize - 1;
+	pContext->font = GLIB_FontNarrow6x8;
+	return GLIB_OK;
+}
+
+EMSTATUS GLIB_setFont(GLIB_Context_t *pContext, GLIB_Font_t *pFont) {
+	if (pContext == NULL || pFont == NULL) {
+		return GLIB_ERROR_INVALID_ARGUMENT;
+	}
+	pContext->font = *pFont;
+	return GLIB_OK;
+}
+
+EMSTATUS GLIB_setClippingRegion(GLIB_Context_t *pContext,
+		const GLIB_Rectangle_t *pRect) {
+	if (pRect->xMin > pRect->xMax || pRect->yMin > pRect->yMax) {
+		return GLIB_ERROR_INVALID_ARGUMENT;
+	}
+	pContext->clippingRegion = *pRect;
+	return GLIB_OK;
+}
+
+EMSTATUS GLIB_clear(GLIB_Context_t *pContext) {
+	GLIB_Context_t whole = *pContext;
+
+	whole.clippingRegion.xMin = 0;
+	whole.clippingRegion.yMin = 0;
+	whole.clippingRegion.xMax = SIM_PANEL_WIDTH - 1;
+	whole.clippingRegion.yMax = SIM_PANEL_HEIGHT - 1;
+	for (int32_t y = 0; y < SIM_PANEL_HEIGHT; y++) {
+		plot_span(&whole, 0, SIM_PANEL_WIDTH - 1, y, pContext->backgroundColor);
+	}
+	return GLIB_OK;
+}
+
+EMSTATUS GLIB_drawPixel(GLIB_Context_t *pContext, int32_t x, int32_t y) {
+	plot_span(pContext, x, x, y, pContext->foregroundColor);
+	return GLIB_OK;
+}
+
+EMSTATUS GLIB_drawLineH(GLIB_Context_t *pContext, int32_t x1, int32_t y1,
+		int32_t x2) {
+	if (x1 > x2) {
+		int32_t swap = x1;
+
+		x1 = x2;
+		x2 = swap;
+	}
+	plot_span(pContext, x1, x2, y1, pContext->foregroundColor);
+	return GLIB_OK;
+}
+
+EMSTATUS GLIB_drawRectFilled(GLIB_Context_t *pContext,
+		const GLIB_Rectangle_t *pRect) {
+	if (pRect->xMin > pRect->xMax || pRect->yMin > pRect->yMax) {
+		return GLIB_ERROR_INVALID_ARGUMENT;
+	}
+	for (int32_t y = pRect->yMin; y <= pRect->yMax; y++) {
+		plot_span(pContext, pRect->xMin, pRect->xMax, y,
+				pContext->foregroundColor);
+	}
+	return GLIB_OK;
+}
+
+/***************************************************************************//**
+ * @brief Midpoint circle, filled with one horizontal run per row.
+ ******************************************************************************/
+EMSTATUS GLIB_drawCircleFilled(GLIB_Context_t *pContext, int32_t xCenter,
+		int32_t yCenter, uint32_t radius) {
+	int32_t x = radius;
+	int32_t y = 0;
+	int32_t err = 1 - x;
+	uint32_t color = pContext->foregroundColor;
+
+	while (x >= y) {
+		plot_span(pContext, xCenter - x, xCenter + x, yCenter + y, color);
+		plot_span(pContext, xCenter - x, xCenter + x, yCenter - y, color);
+		plot_span(pContext, xCenter - y, xCenter + y, yCenter + x, color);
+		plot_span(pContext, xCenter - y, xCenter + y, yCenter - x, color);
+		y++;
+		if (err < 0) {
+			err += 2 * y + 1;
+		} else {
+			x--;
+			err += 2 * (y - x) + 1;
+		}
+	}
+	return GLIB_OK;
+}
+
+/***************************************************************************//**
+ * @brief 1 bit per pixel bitmap, rows not padded, bit 0 of a byte first. Set
+ *        bits in the foreground colour, the others in the background colour.
+ ******************************************************************************/
+EMSTATUS GLIB_drawBitmap(GLIB_Context_t *pContext, int32_t x, int32_t y,
+		uint32_t width, uint32_t height, const uint8_t *picData) {
+	uint32_t bit = 0;
+
+	for (uint32_t row = 0; row < height; row++) {
+		for (uint32_t col = 0; col < width; col++, bit++) {
+			bool set = (picData[bit >> 3] >> (bit & 7)) & 1;
+
+			plot_span(pContext, x + col, x + col, y + row,
+					set ? pContext->foregroundColor : pContext->backgroundColor);
+		}
+	}
+	return GLIB_OK;
+}
+
+EMSTATUS GLIB_drawString(GLIB_Context_t *pContext, const char *pString,
+		uint32_t sLength, int32_t x0, int32_t y0, bool opaque) {
+	const GLIB_Font_t *font = &pContext->font;
+	int32_t x = x0;
+	int32_t y = y0;
+
+	if (font->class != FullFont) {
+		return GLIB_ERROR_INVALID_ARGUMENT;
+	}
+	for (uint32_t i = 0; i < sLength && pString[i] != '\0'; i++) {
+		uint32_t index = (uint8_t) (pString[i] - ' ');
+
+		if (pString[i] == '\n') {
+			x = x0;
+			y += font->fontHeight + font->lineSpacing;
+			continue;
+		}
+		if (index < font->fontRowOffset) {
+			for (uint32_t row = 0; row < font->fontHeight; row++) {
+				uint32_t bits = font_row(font,
+						index + row * font->fontRowOffset);
+
+				for (uint32_t col = 0; col < font->fontWidth; col++) {
+					if ((bits >> col) & 1) {
+						plot_span(pContext, x + col, x + col, y + row,
+								pContext->foregroundColor);
+					} else if (opaque) {
+						plot_span(pContext, x + col, x + col, y + row,
+								pContext->backgroundColor);
+					}
+				}
+			}
+		}
+		x += font->fontWidth + font->charSpacing;
+	}
+	return GLIB_OK;
+}
@@ -0,0 +1,165 @@
+/*
+ * i2c_sim.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "em_device.h"
+#include "em_i2c.h"
+#include "sim.h"
+
+// Fake I2C bus behind the EMLIB master calls. A transfer moves one byte per
+// interrupt, the address byte included, and the devices attached to the bus
+// take or give the whole buffer of a phase when their address is acked. The
+// bus time is counted in SCL periods, 9 per byte and one per start, repeated
+// start and stop.
+
+#define SIM_I2C_DEVICES 4
+
+void I2C0_IRQHandler(void);
+
+static const SimI2cDevice *devices[SIM_I2C_DEVICES];
+static SimI2cStats stats;
+
+// the transfer on the bus, NULL when idle
+static I2C_TransferSeq_TypeDef *seq;
+static const SimI2cDevice *target;
+static uint32_t phase;
+// data byte of the phase, -1 for the address byte
+static int32_t pos;
+
+static uint32_t fail_count;
+static I2C_TransferReturn_TypeDef fail_result;
+
+void SIM_I2cReset(void) {
+	for (uint32_t i = 0; i < SIM_I2C_DEVICES; i++) {
+		devices[i] = NULL;
+	}
+	stats = (SimI2cStats ) { 0 };
+	seq = NULL;
+	fail_count = 0;
+}
+
+void SIM_I2cAttach(const SimI2cDevice *device) {
+	for (uint32_t i = 0; i < SIM_I2C_DEVICES; i++) {
+		if (devices[i] == NULL) {
+			devices[i] = device;
+			return;
+		}
+	}
+}
+
+void SIM_I2cFail(uint32_t count, int result) {
+	fail_count = count;
+	fail_result = (I2C_TransferReturn_TypeDef) result;
+}
+
+SimI2cStats SIM_I2cGetStats(void) {
+	return stats;
+}
+
+bool SIM_I2cIsBusy(void) {
+	return seq != NULL;
+}
+
+bool SIM_I2cRun(void) {
+	if (seq == NULL || (I2C0->IEN & I2C_IEN_ACK) == 0) {
+		return false;
+	}
+	I2C0_IRQHandler();
+	return true;
+}
+
+static const SimI2cDevice *find(uint16_t addr) {
+	for (uint32_t i = 0; i < SIM_I2C_DEVICES; i++) {
+		if (devices[i] != NULL && devices[i]->addr == addr) {
+			return devices[i];
+		}
+	}
+	return NULL;
+}
+
+static bool is_read_phase(void) {
+	return (seq->flags == I2C_FLAG_READ) || phase == 1;
+}
+
+static uint32_t phases(void) {
+	return (seq->flags == I2C_FLAG_WRITE_READ) ? 2 : 1;
+}
+
+static I2C_TransferReturn_TypeDef finish(I2C_TransferReturn_TypeDef result) {
+	// stop condition
+	stats.bits++;
+	stats.transfers++;
+	if (result == i2cTransferNack) {
+		stats.nacks++;
+	}
+	seq = NULL;
+	return result;
+}
+
+I2C_TransferReturn_TypeDef I2C_TransferInit(I2C_TypeDef *i2c,
+		I2C_TransferSeq_TypeDef *s) {
+	(void) i2c;
+	if (seq != NULL) {
+		return i2cTransferUsageFault;
+	}
+	if (s->flags != I2C_FLAG_WRITE && s->flags != I2C_FLAG_READ
+			&& s->flags != I2C_FLAG_WRITE_READ) {
+		return i2cTransferUsageFault;
+	}
+	seq = s;
+	target = find(s->addr);
+	phase = 0;
+	pos = -1;
+	// start condition
+	stats.bits++;
+	return i2cTransferInProgress;
+}
+
+I2C_TransferReturn_TypeDef I2C_Transfer(I2C_TypeDef *i2c) {
+	uint16_t len;
+
+	(void) i2c;
+	if (seq == NULL) {
+		return i2cTransferUsageFault;
+	}
+	len = seq->buf[phase].len;
+	stats.bits += 9;
+
+	if (pos < 0) {
+		bool ack;
+
+		if (fail_count > 0) {
+			fail_count--;
+			return finish(fail_result);
+		}
+		if (target == NULL) {
+			ack = false;
+		} else if (is_read_phase()) {
+			ack = target->read(target->ctx, seq->buf[phase].data, len);
+		} else {
+			ack = target->write(target->ctx, seq->buf[phase].data, len);
+		}
+		if (!ack) {
+			return finish(i2cTransferNack);
+		}
+	} else {
+		stats.bytes++;
+	}
+
+	if (++pos < len) {
+		return i2cTransferInProgress;
+	}
+	if (++phase < phases()) {
+		// repeated start
+		stats.bits++;
+		pos = -1;
+		return i2cTransferInProgress;
+	}
+	return finish(i2cTransferDone);
+}
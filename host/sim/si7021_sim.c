@@ -0,0 +1,141 @@
+/*
+ * si7021_sim.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "sl_sleeptimer.h"
+#include "si7013.h"
+#include "sim.h"
+
+// Si7021 on the fake I2C bus. The no-hold measure command starts a
+// conversion on the sleeptimer's clock, and like the real part the sensor
+// NACKs its address until the conversion is done. The temperature of the
+// last conversion and the electronic ID read back right away.
+
+#define MEASURE_RH_NO_HOLD 0xF5
+#define READ_PREV_TEMP     0xE0
+#define READ_ID2_1         0xFC
+#define READ_ID2_2         0xC9
+#define SI7021_DEVICE_ID   0x15
+
+typedef enum Pointer {
+	POINTER_NONE,
+	POINTER_RH,
+	POINTER_TEMP,
+	POINTER_ID
+} Pointer;
+
+static Pointer pointer;
+static uint32_t conversion_ticks;
+static uint32_t started;
+static bool converting;
+static uint16_t rh_word;
+static uint16_t temp_word;
+static uint32_t rh_set;
+static int32_t temp_set;
+static SimSi7021Stats stats;
+
+// Inverse of the conversions of the Si7013 driver, rounded up to a word the
+// driver reads back at or just above the value (it masks the two status bits).
+static uint16_t to_word(int32_t value, int32_t offset, uint32_t scale) {
+	uint32_t word = (uint32_t) ((((uint64_t) (value + offset) << 13) + scale
+			- 1) / scale);
+
+	return (uint16_t) ((word + 3) & ~3u);
+}
+
+static bool is_converting(void) {
+	return converting
+			&& sl_sleeptimer_get_tick_count() - started < conversion_ticks;
+}
+
+static bool sensor_write(void *ctx, const uint8_t *data, uint16_t len) {
+	(void) ctx;
+	if (is_converting()) {
+		stats.nacks++;
+		return false;
+	}
+	if (len == 0) {
+		return true;
+	}
+	switch (data[0]) {
+	case MEASURE_RH_NO_HOLD:
+		converting = true;
+		started = sl_sleeptimer_get_tick_count();
+		rh_word = to_word((int32_t) rh_set, 6000, 15625) | 0x02;
+		temp_word = to_word(temp_set, 46850, 21965);
+		pointer = POINTER_RH;
+		stats.conversions++;
+		return true;
+	case READ_PREV_TEMP:
+		pointer = POINTER_TEMP;
+		return true;
+	case READ_ID2_1:
+		pointer = (len == 2 && data[1] == READ_ID2_2) ?
+				POINTER_ID : POINTER_NONE;
+		return true;
+	default:
+		pointer = POINTER_NONE;
+		return true;
+	}
+}
+
+static bool sensor_read(void *ctx, uint8_t *data, uint16_t len) {
+	uint16_t word;
+
+	(void) ctx;
+	if (is_converting()) {
+		stats.nacks++;
+		return false;
+	}
+
+	switch (pointer) {
+	case POINTER_RH:
+		word = rh_word;
+		break;
+	case POINTER_TEMP:
+		word = temp_word;
+		break;
+	case POINTER_ID:
+		for (uint16_t i = 0; i < len; i++) {
+			data[i] = (i == 0) ? SI7021_DEVICE_ID : 0xFF;
+		}
+		return true;
+	default:
+		word = 0xFFFF;
+		break;
+	}
+	for (uint16_t i = 0; i < len; i++) {
+		data[i] = (i == 0) ? (uint8_t) (word >> 8) : (uint8_t) word;
+	}
+	return true;
+}
+
+static const SimI2cDevice device = { SI7021_ADDR, sensor_write, sensor_read,
+		NULL };
+
+void SIM_Si7021Attach(uint32_t conversion_ms) {
+	SIM_Si7021SetConversion(conversion_ms);
+	SIM_Si7021Set(50000, 25000);
+	converting = false;
+	pointer = POINTER_NONE;
+	stats = (SimSi7021Stats ) { 0 };
+	SIM_I2cAttach(&device);
+}
+
+void SIM_Si7021SetConversion(uint32_t ms) {
+	conversion_ticks = sl_sleeptimer_ms_to_tick(ms);
+}
+
+void SIM_Si7021Set(uint32_t rh, int32_t temp) {
+	rh_set = rh;
+	temp_set = temp;
+}
+
+SimSi7021Stats SIM_Si7021GetStats(void) {
+	return stats;
+}
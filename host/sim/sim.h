@@ -0,0 +1,97 @@
+/*
+ * sim.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Controls of the host stand-ins for the board, used by the tests and the
+// benchmarks.
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#define SIM_PANEL_WIDTH     128
+#define SIM_PANEL_HEIGHT    128
+#define SIM_PANEL_ROW_BYTES (SIM_PANEL_WIDTH / 8)
+
+typedef struct SimDisplayStats {
+	uint64_t plotted; // pixels GLIB wrote, whatever their old value
+	uint64_t changed; // panel pixels a transfer flipped
+	uint64_t lines; // panel lines transferred
+} SimDisplayStats;
+
+// What the panel shows, SIM_PANEL_ROW_BYTES per line, bit 0 leftmost, set
+// for any colour but black.
+const uint8_t *SIM_DisplayPanel(void);
+SimDisplayStats SIM_DisplayGetStats(void);
+void SIM_DisplayResetStats(void);
+
+// Frame buffer the DMD draws into, the one DMD_selectFramebuffer chose, and
+// the count of pixels GLIB wrote to it. For sim/glib_sim.c.
+uint8_t *SIM_DmdFrame(void);
+void SIM_DmdCountPlotted(uint32_t pixels);
+
+// Run by EMU_EnterEM1 and EMU_EnterEM2 in place of sleeping. Waits that
+// nothing ends are the caller's bug, so the default hook aborts.
+void SIM_SetIdleHook(void (*hook)(void));
+
+// Bus clock the I2C time is counted in, the standard mode I2CSPM sets up.
+#define SIM_I2C_FREQUENCY 100000u
+
+// A device on the fake I2C bus of sim/i2c_sim.c. write gets the bytes of a
+// write phase, read fills those of a read phase, both when the address is
+// sent, and NACK the address by returning false.
+typedef struct SimI2cDevice {
+	uint16_t addr; // 8-bit bus address, as in I2C_TransferSeq_TypeDef
+	bool (*write)(void *ctx, const uint8_t *data, uint16_t len);
+	bool (*read)(void *ctx, uint8_t *data, uint16_t len);
+	void *ctx;
+} SimI2cDevice;
+
+typedef struct SimI2cStats {
+	uint32_t transfers; // ended, successful or not
+	uint32_t nacks;
+	uint32_t bytes; // data bytes on the bus, addresses not counted
+	uint64_t bits; // SCL periods the transfers took
+} SimI2cStats;
+
+// detaches the devices and clears the statistics
+void SIM_I2cReset(void);
+void SIM_I2cAttach(const SimI2cDevice *device);
+// the next count transfers end with result on their address byte
+void SIM_I2cFail(uint32_t count, int result);
+SimI2cStats SIM_I2cGetStats(void);
+bool SIM_I2cIsBusy(void);
+// Runs the I2C interrupt for the next byte if a transfer is on the bus and
+// its interrupts are enabled. Returns false if there was nothing to run.
+bool SIM_I2cRun(void);
+
+typedef struct SimSi7021Stats {
+	uint32_t conversions;
+	uint32_t nacks; // transfers addressed to it during a conversion
+} SimSi7021Stats;
+
+// Attaches a Si7021 to the fake I2C bus at SI7021_ADDR, reading 50 %RH and
+// 25 degrees Celsius, whose measurement takes conversion_ms.
+void SIM_Si7021Attach(uint32_t conversion_ms);
+void SIM_Si7021SetConversion(uint32_t ms);
+// milli-percent and milli-degrees Celsius the next measurement gives
+void SIM_Si7021Set(uint32_t rh, int32_t temp);
+SimSi7021Stats SIM_Si7021GetStats(void);
+
+// Level of a GPIO pin as GPIO_PinInGet reads it, an edge raises the interrupt
+// flag of the pin.
+void SIM_GpioSetPin(unsigned int port, unsigned int pin, bool level);
+
+static inline uint64_t SIM_NowNs(void) {
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000u + (uint64_t) ts.tv_nsec;
+}
+
+#endif /* SIM_H */
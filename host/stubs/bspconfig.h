@@ -0,0 +1,17 @@
+/*
+ * bspconfig.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the SLSTK3400A board configuration.
+
+#ifndef BSPCONFIG_H
+#define BSPCONFIG_H
+
+#define BSP_GPIO_PB0_PORT gpioPortC
+#define BSP_GPIO_PB0_PIN  9
+#define BSP_GPIO_PB1_PORT gpioPortC
+#define BSP_GPIO_PB1_PIN  10
+
+#endif /* BSPCONFIG_H */
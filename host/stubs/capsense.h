@@ -0,0 +1,31 @@
+/*
+ * capsense.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for external_copied_files/capsense.h, the slider is never
+// touched.
+
+#ifndef CAPSENSE_H
+#define CAPSENSE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+static inline void CAPSENSE_Init(void) {
+}
+
+static inline void CAPSENSE_Sense(void) {
+}
+
+static inline bool CAPSENSE_getPressed(uint8_t channel) {
+	(void) channel;
+	return false;
+}
+
+static inline int32_t CAPSENSE_getSliderPosition(void) {
+	return -1;
+}
+
+#endif /* CAPSENSE_H */
@@ -0,0 +1,37 @@
+/*
+ * display.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the Gecko SDK header of the same name, implemented by
+// sim/display_sim.c. The one device is a headless 128x128 memory LCD.
+
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+#include <stdint.h>
+
+#include "em_types.h"
+
+#define DISPLAY_EMSTATUS_OK                0
+#define DISPLAY_EMSTATUS_INVALID_PARAMETER 0x8001
+
+typedef struct {
+	unsigned int width;
+	unsigned int height;
+	unsigned int stride;
+} DISPLAY_Geometry_t;
+
+typedef struct DISPLAY_Device_t {
+	char *name;
+	DISPLAY_Geometry_t geometry;
+	EMSTATUS (*pPixelMatrixDraw)(struct DISPLAY_Device_t *device,
+			void *pixelMatrix, unsigned int startColumn, unsigned int width,
+			unsigned int startRow, unsigned int height);
+} DISPLAY_Device_t;
+
+EMSTATUS DISPLAY_Init(void);
+EMSTATUS DISPLAY_DeviceGet(int displayDeviceNo, DISPLAY_Device_t *device);
+
+#endif /* DISPLAY_H */
@@ -0,0 +1,35 @@
+/*
+ * dmd.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the Gecko SDK header of the same name, implemented by
+// sim/display_sim.c for a 128x128 1 bit per pixel memory LCD.
+
+#ifndef DMD_H
+#define DMD_H
+
+#include <stdint.h>
+
+#include "em_types.h"
+
+#define DMD_OK                         0
+#define DMD_ERROR_BASE                 0x8000
+#define DMD_ERROR_DRIVER_NOT_INITIALIZED (DMD_ERROR_BASE | 0x0001)
+
+typedef struct __DMD_DisplayGeometry {
+	uint16_t xSize;
+	uint16_t ySize;
+	uint16_t xClipStart;
+	uint16_t yClipStart;
+	uint16_t clipWidth;
+	uint16_t clipHeight;
+} DMD_DisplayGeometry;
+
+EMSTATUS DMD_init(void *initData);
+EMSTATUS DMD_getDisplayGeometry(DMD_DisplayGeometry **geometry);
+EMSTATUS DMD_selectFramebuffer(void *framebuffer);
+EMSTATUS DMD_updateDisplay(void);
+
+#endif /* DMD_H */
@@ -0,0 +1,55 @@
+/*
+ * em_adc.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the Gecko SDK header of the same name. A started
+// conversion completes at once with SIM_ADC_RESULT.
+
+#ifndef EM_ADC_H
+#define EM_ADC_H
+
+#include <stdint.h>
+
+#include "em_device.h"
+
+// VDD / 3 of a fresh CR2032 at the 1.25 V reference, 12 bits
+#define SIM_ADC_RESULT 3276
+
+#define ADC_IEN_SINGLE (1u << 0)
+
+typedef enum {
+	adcAcqTime1,
+	adcAcqTime16
+} ADC_AcqTime_TypeDef;
+
+typedef enum {
+	adcSingleInpVDDDiv3
+} ADC_SingleInput_TypeDef;
+
+typedef enum {
+	adcStartSingle
+} ADC_Start_TypeDef;
+
+typedef struct {
+	uint32_t timebase;
+} ADC_Init_TypeDef;
+
+typedef struct {
+	ADC_AcqTime_TypeDef acqTime;
+	ADC_SingleInput_TypeDef input;
+} ADC_InitSingle_TypeDef;
+
+#define ADC_INIT_DEFAULT       { 0 }
+#define ADC_INITSINGLE_DEFAULT { adcAcqTime1, adcSingleInpVDDDiv3 }
+
+void ADC_Init(ADC_TypeDef *adc, const ADC_Init_TypeDef *init);
+void ADC_InitSingle(ADC_TypeDef *adc, const ADC_InitSingle_TypeDef *init);
+void ADC_IntEnable(ADC_TypeDef *adc, uint32_t flags);
+uint32_t ADC_IntGet(ADC_TypeDef *adc);
+void ADC_IntClear(ADC_TypeDef *adc, uint32_t flags);
+void ADC_Start(ADC_TypeDef *adc, ADC_Start_TypeDef cmd);
+uint32_t ADC_DataSingleGet(ADC_TypeDef *adc);
+
+#endif /* EM_ADC_H */
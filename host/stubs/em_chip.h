@@ -0,0 +1,15 @@
+/*
+ * em_chip.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the Gecko SDK header of the same name.
+
+#ifndef EM_CHIP_H
+#define EM_CHIP_H
+
+static inline void CHIP_Init(void) {
+}
+
+#endif /* EM_CHIP_H */
@@ -0,0 +1,39 @@
+/*
+ * em_cmu.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the Gecko SDK header of the same name.
+
+#ifndef EM_CMU_H
+#define EM_CMU_H
+
+#include <stdbool.h>
+
+typedef enum {
+	cmuClock_HFLE,
+	cmuClock_LFA,
+	cmuClock_GPIO,
+	cmuClock_ADC0,
+	cmuClock_I2C0
+} CMU_Clock_TypeDef;
+
+typedef enum {
+	cmuSelect_LFXO,
+	cmuSelect_LFRCO,
+	cmuSelect_ULFRCO
+} CMU_Select_TypeDef;
+
+static inline void CMU_ClockEnable(CMU_Clock_TypeDef clock, bool enable) {
+	(void) clock;
+	(void) enable;
+}
+
+static inline void CMU_ClockSelectSet(CMU_Clock_TypeDef clock,
+		CMU_Select_TypeDef ref) {
+	(void) clock;
+	(void) ref;
+}
+
+#endif /* EM_CMU_H */
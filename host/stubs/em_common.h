@@ -0,0 +1,19 @@
+/*
+ * em_common.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the Gecko SDK header of the same name.
+
+#ifndef EM_COMMON_H
+#define EM_COMMON_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "em_device.h"
+
+#define SL_WEAK __attribute__((weak))
+
+#endif /* EM_COMMON_H */
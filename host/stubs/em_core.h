@@ -0,0 +1,41 @@
+/*
+ * em_core.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the Gecko SDK header of the same name. The host runs the
+// simulated interrupts from the thread that advances the simulation, never in
+// the middle of an atomic section, so the sections only need to compile.
+
+#ifndef EM_CORE_H
+#define EM_CORE_H
+
+#include <stdint.h>
+
+typedef uint32_t CORE_irqState_t;
+
+#define CORE_DECLARE_IRQ_STATE        CORE_irqState_t irqState
+#define CORE_ENTER_ATOMIC()           irqState = CORE_EnterAtomic()
+#define CORE_EXIT_ATOMIC()            CORE_ExitAtomic(irqState)
+#define CORE_ENTER_CRITICAL()         irqState = CORE_EnterAtomic()
+#define CORE_EXIT_CRITICAL()          CORE_ExitAtomic(irqState)
+#define CORE_ATOMIC_SECTION(yourcode) \
+	{                                   \
+		CORE_DECLARE_IRQ_STATE;           \
+		CORE_ENTER_ATOMIC();              \
+		{                                 \
+			yourcode                        \
+		}                                 \
+		CORE_EXIT_ATOMIC();               \
+	}
+
+static inline CORE_irqState_t CORE_EnterAtomic(void) {
+	return 0;
+}
+
+static inline void CORE_ExitAtomic(CORE_irqState_t irqState) {
+	(void) irqState;
+}
+
+#endif /* EM_CORE_H */
@@ -0,0 +1,68 @@
+/*
+ * em_device.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the CMSIS device header: the intrinsics, the interrupt
+// numbers and the few registers the sources touch. The NVIC calls do nothing,
+// the simulations call the interrupt handlers themselves.
+
+#ifndef EM_DEVICE_H
+#define EM_DEVICE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifndef __STATIC_INLINE
+#define __STATIC_INLINE static inline
+#endif
+
+static inline uint32_t __CLZ(uint32_t value) {
+	return value == 0 ? 32 : (uint32_t) __builtin_clz(value);
+}
+
+static inline void __DMB(void) {
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+typedef enum IRQn {
+	GPIO_EVEN_IRQn = 1,
+	I2C0_IRQn = 9,
+	GPIO_ODD_IRQn = 10,
+	ADC0_IRQn = 12,
+	RTC_IRQn = 14
+} IRQn_Type;
+
+static inline void NVIC_ClearPendingIRQ(IRQn_Type irq) {
+	(void) irq;
+}
+
+static inline void NVIC_EnableIRQ(IRQn_Type irq) {
+	(void) irq;
+}
+
+static inline void NVIC_DisableIRQ(IRQn_Type irq) {
+	(void) irq;
+}
+
+typedef struct {
+	volatile uint32_t IF;
+	volatile uint32_t IEN;
+} I2C_TypeDef;
+
+typedef struct {
+	volatile uint32_t CAL;
+} ADC_TypeDef;
+
+#define _ADC_CAL_SINGLEOFFSET_SHIFT 0
+#define _ADC_CAL_SINGLEGAIN_SHIFT   8
+
+extern I2C_TypeDef SIM_I2C0;
+extern ADC_TypeDef SIM_ADC0;
+
+#define I2C0 (&SIM_I2C0)
+#define ADC0 (&SIM_ADC0)
+
+#endif /* EM_DEVICE_H */
@@ -0,0 +1,18 @@
+/*
+ * em_emu.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the Gecko SDK header of the same name. Sleeping runs the
+// idle hook of the simulation, see SIM_SetIdleHook().
+
+#ifndef EM_EMU_H
+#define EM_EMU_H
+
+#include <stdbool.h>
+
+void EMU_EnterEM1(void);
+void EMU_EnterEM2(bool restore);
+
+#endif /* EM_EMU_H */
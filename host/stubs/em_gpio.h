@@ -0,0 +1,40 @@
+/*
+ * em_gpio.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the Gecko SDK header of the same name. The pin levels and
+// the interrupt flags live in sim/em_sim.c, see SIM_GpioSetPin().
+
+#ifndef EM_GPIO_H
+#define EM_GPIO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef enum {
+	gpioPortA,
+	gpioPortB,
+	gpioPortC,
+	gpioPortD,
+	gpioPortE,
+	gpioPortF
+} GPIO_Port_TypeDef;
+
+typedef enum {
+	gpioModeDisabled,
+	gpioModeInput,
+	gpioModeInputPull,
+	gpioModePushPull
+} GPIO_Mode_TypeDef;
+
+void GPIO_PinModeSet(GPIO_Port_TypeDef port, unsigned int pin,
+		GPIO_Mode_TypeDef mode, unsigned int out);
+unsigned int GPIO_PinInGet(GPIO_Port_TypeDef port, unsigned int pin);
+void GPIO_IntConfig(GPIO_Port_TypeDef port, unsigned int pin,
+		bool risingEdge, bool fallingEdge, bool enable);
+uint32_t GPIO_IntGet(void);
+void GPIO_IntClear(uint32_t flags);
+
+#endif /* EM_GPIO_H */
@@ -0,0 +1,67 @@
+/*
+ * em_i2c.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the Gecko SDK header of the same name. I2C_TransferInit
+// and I2C_Transfer are left to the simulation that links them.
+
+#ifndef EM_I2C_H
+#define EM_I2C_H
+
+#include <stdint.h>
+
+#include "em_device.h"
+
+#define I2C_FLAG_WRITE       0x0001
+#define I2C_FLAG_READ        0x0002
+#define I2C_FLAG_WRITE_READ  0x0004
+#define I2C_FLAG_WRITE_WRITE 0x0008
+#define I2C_FLAG_10BIT_ADDR  0x0010
+
+#define I2C_IEN_ACK          (1u << 6)
+#define I2C_IEN_NACK         (1u << 7)
+#define I2C_IEN_MSTOP        (1u << 8)
+#define I2C_IEN_ARBLOST      (1u << 9)
+#define I2C_IEN_BUSERR       (1u << 10)
+#define I2C_IEN_RXDATAV      (1u << 5)
+#define _I2C_IEN_MASK        0x0007FFFFu
+#define _I2C_IF_MASK         0x0007FFFFu
+
+typedef enum {
+	i2cTransferInProgress = 1,
+	i2cTransferDone = 0,
+	i2cTransferNack = -1,
+	i2cTransferBusErr = -2,
+	i2cTransferArbLost = -3,
+	i2cTransferUsageFault = -4,
+	i2cTransferSwFault = -5
+} I2C_TransferReturn_TypeDef;
+
+typedef struct {
+	uint16_t addr;
+	uint16_t flags;
+	struct {
+		uint8_t *data;
+		uint16_t len;
+	} buf[2];
+} I2C_TransferSeq_TypeDef;
+
+static inline void I2C_IntEnable(I2C_TypeDef *i2c, uint32_t flags) {
+	i2c->IEN |= flags;
+}
+
+static inline void I2C_IntDisable(I2C_TypeDef *i2c, uint32_t flags) {
+	i2c->IEN &= ~flags;
+}
+
+static inline void I2C_IntClear(I2C_TypeDef *i2c, uint32_t flags) {
+	i2c->IF &= ~flags;
+}
+
+I2C_TransferReturn_TypeDef I2C_TransferInit(I2C_TypeDef *i2c,
+		I2C_TransferSeq_TypeDef *seq);
+I2C_TransferReturn_TypeDef I2C_Transfer(I2C_TypeDef *i2c);
+
+#endif /* EM_I2C_H */
@@ -0,0 +1,15 @@
+/*
+ * em_rtc.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the Gecko SDK header of the same name, the sleeptimer
+// runs on the simulated RTC of sl_sleeptimer_hal_sim.c instead.
+
+#ifndef EM_RTC_H
+#define EM_RTC_H
+
+#include "em_device.h"
+
+#endif /* EM_RTC_H */
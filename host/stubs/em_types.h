@@ -0,0 +1,18 @@
+/*
+ * em_types.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the Gecko SDK header of the same name, only what the
+// sources in src/ and service/ use.
+
+#ifndef EM_TYPES_H
+#define EM_TYPES_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint32_t EMSTATUS;
+
+#endif /* EM_TYPES_H */
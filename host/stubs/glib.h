@@ -0,0 +1,81 @@
+/*
+ * glib.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the Gecko SDK header of the same name, implemented by
+// sim/glib_sim.c on top of the DMD frame buffer. Only the primitives the
+// sources draw with are there.
+
+#ifndef GLIB_H
+#define GLIB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "em_types.h"
+#include "dmd.h"
+
+#define GLIB_OK                       0
+#define GLIB_ERROR_BASE               0x00000000
+#define GLIB_ERROR_NOTHING_TO_DRAW    (GLIB_ERROR_BASE | 0x0001)
+#define GLIB_ERROR_INVALID_ARGUMENT   (GLIB_ERROR_BASE | 0x0002)
+
+#define Black 0x000000
+#define White 0xffffff
+
+typedef enum __GLIB_Font_Class {
+	NumbersOnly,
+	FullFont
+} GLIB_Font_Class;
+
+typedef struct __GLIB_Font_t {
+	void *pFontPixMap;
+	uint16_t cntOfMapElements;
+	uint8_t sizeOfMapElement;
+	uint16_t fontRowOffset;
+	uint8_t fontWidth;
+	uint8_t fontHeight;
+	uint8_t lineSpacing;
+	uint8_t charSpacing;
+	GLIB_Font_Class class;
+} GLIB_Font_t;
+
+typedef struct __GLIB_Rectangle_t {
+	int32_t xMin;
+	int32_t yMin;
+	int32_t xMax;
+	int32_t yMax;
+} GLIB_Rectangle_t;
+
+typedef struct __GLIB_Context_t {
+	DMD_DisplayGeometry *pDisplayGeometry;
+	uint32_t backgroundColor;
+	uint32_t foregroundColor;
+	GLIB_Rectangle_t clippingRegion;
+	GLIB_Font_t font;
+} GLIB_Context_t;
+
+extern const GLIB_Font_t GLIB_FontNarrow6x8;
+extern const GLIB_Font_t GLIB_FontNormal8x8;
+
+EMSTATUS GLIB_contextInit(GLIB_Context_t *pContext);
+EMSTATUS GLIB_setFont(GLIB_Context_t *pContext, GLIB_Font_t *pFont);
+EMSTATUS GLIB_setClippingRegion(GLIB_Context_t *pContext,
+		const GLIB_Rectangle_t *pRect);
+EMSTATUS GLIB_clear(GLIB_Context_t *pContext);
+EMSTATUS GLIB_drawPixel(GLIB_Context_t *pContext, int32_t x, int32_t y);
+EMSTATUS GLIB_drawLineH(GLIB_Context_t *pContext, int32_t x1, int32_t y1,
+		int32_t x2);
+EMSTATUS GLIB_drawRectFilled(GLIB_Context_t *pContext,
+		const GLIB_Rectangle_t *pRect);
+EMSTATUS GLIB_drawCircleFilled(GLIB_Context_t *pContext, int32_t xCenter,
+		int32_t yCenter, uint32_t radius);
+EMSTATUS GLIB_drawBitmap(GLIB_Context_t *pContext, int32_t x, int32_t y,
+		uint32_t width, uint32_t height, const uint8_t *picData);
+EMSTATUS GLIB_drawString(GLIB_Context_t *pContext, const char *pString,
+		uint32_t sLength, int32_t x0, int32_t y0, bool opaque);
+
+#endif /* GLIB_H */
@@ -0,0 +1,25 @@
+/*
+ * i2cspm.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the Gecko SDK header of the same name.
+
+#ifndef I2CSPM_H
+#define I2CSPM_H
+
+#include "em_device.h"
+#include "em_i2c.h"
+
+typedef struct {
+	I2C_TypeDef *port;
+} I2CSPM_Init_TypeDef;
+
+#define I2CSPM_INIT_DEFAULT { I2C0 }
+
+static inline void I2CSPM_Init(I2CSPM_Init_TypeDef *init) {
+	(void) init;
+}
+
+#endif /* I2CSPM_H */
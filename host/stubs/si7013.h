@@ -0,0 +1,14 @@
+/*
+ * si7013.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the Gecko SDK header of the same name.
+
+#ifndef SI7013_H
+#define SI7013_H
+
+#define SI7021_ADDR 0x80
+
+#endif /* SI7013_H */
@@ -0,0 +1,231 @@
+/*
+ * sl_sleeptimer.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the Gecko SDK header of the same name, declaring what
+// service/sl_sleeptimer.c implements. The host build runs it on the simulated
+// RTC of service/sl_sleeptimer_hal_sim.c.
+
+#ifndef SL_SLEEPTIMER_H
+#define SL_SLEEPTIMER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "em_device.h"
+#include "sl_status.h"
+
+#ifndef SL_SLEEPTIMER_WALLCLOCK_CONFIG
+#define SL_SLEEPTIMER_WALLCLOCK_CONFIG 1
+#endif
+
+#define SL_SLEEPTIMER_NO_HIGH_PRECISION_HF_CLOCKS_REQUIRED_FLAG 0x01
+
+#define SLEEPTIMER_ENUM(name) typedef uint8_t name; enum name##_enum
+
+typedef struct sl_sleeptimer_timer_handle sl_sleeptimer_timer_handle_t;
+
+typedef void (*sl_sleeptimer_timer_callback_t)(sl_sleeptimer_timer_handle_t *handle,
+                                               void *data);
+
+struct sl_sleeptimer_timer_handle {
+  void *callback_data;
+  uint8_t priority;
+  uint16_t option_flags;
+  sl_sleeptimer_timer_handle_t *next;
+  sl_sleeptimer_timer_callback_t callback;
+  uint32_t timeout_periodic;
+  uint32_t delta;
+};
+
+SLEEPTIMER_ENUM(sl_sleeptimer_month_t) {
+  MONTH_JANUARY = 0,
+  MONTH_FEBRUARY = 1,
+  MONTH_MARCH = 2,
+  MONTH_APRIL = 3,
+  MONTH_MAY = 4,
+  MONTH_JUNE = 5,
+  MONTH_JULY = 6,
+  MONTH_AUGUST = 7,
+  MONTH_SEPTEMBER = 8,
+  MONTH_OCTOBER = 9,
+  MONTH_NOVEMBER = 10,
+  MONTH_DECEMBER = 11,
+};
+
+SLEEPTIMER_ENUM(sl_sleeptimer_weekDay_t) {
+  DAY_SUNDAY = 0,
+  DAY_MONDAY = 1,
+  DAY_TUESDAY = 2,
+  DAY_WEDNESDAY = 3,
+  DAY_THURSDAY = 4,
+  DAY_FRIDAY = 5,
+  DAY_SATURDAY = 6,
+};
+
+typedef uint32_t sl_sleeptimer_timestamp_t;
+typedef int32_t sl_sleeptimer_time_zone_offset_t;
+
+typedef struct time_date {
+  uint8_t sec;
+  uint8_t min;
+  uint8_t hour;
+  uint8_t month_day;
+  sl_sleeptimer_month_t month;
+  uint16_t year;                           ///< Years since 1900
+  sl_sleeptimer_weekDay_t day_of_week;
+  uint16_t day_of_year;                    ///< 1 to 366
+  sl_sleeptimer_time_zone_offset_t time_zone;
+} sl_sleeptimer_date_t;
+
+sl_status_t sl_sleeptimer_init(void);
+sl_status_t sl_sleeptimer_start_timer(sl_sleeptimer_timer_handle_t *handle,
+                                      uint32_t timeout,
+                                      sl_sleeptimer_timer_callback_t callback,
+                                      void *callback_data,
+                                      uint8_t priority,
+                                      uint16_t option_flags);
+sl_status_t sl_sleeptimer_restart_timer(sl_sleeptimer_timer_handle_t *handle,
+                                        uint32_t timeout,
+                                        sl_sleeptimer_timer_callback_t callback,
+                                        void *callback_data,
+                                        uint8_t priority,
+                                        uint16_t option_flags);
+sl_status_t sl_sleeptimer_start_periodic_timer(sl_sleeptimer_timer_handle_t *handle,
+                                               uint32_t timeout,
+                                               sl_sleeptimer_timer_callback_t callback,
+                                               void *callback_data,
+                                               uint8_t priority,
+                                               uint16_t option_flags);
+sl_status_t sl_sleeptimer_restart_periodic_timer(sl_sleeptimer_timer_handle_t *handle,
+                                                 uint32_t timeout,
+                                                 sl_sleeptimer_timer_callback_t callback,
+                                                 void *callback_data,
+                                                 uint8_t priority,
+                                                 uint16_t option_flags);
+sl_status_t sl_sleeptimer_stop_timer(sl_sleeptimer_timer_handle_t *handle);
+sl_status_t sl_sleeptimer_is_timer_running(sl_sleeptimer_timer_handle_t *handle,
+                                           bool *running);
+sl_status_t sl_sleeptimer_get_timer_time_remaining(sl_sleeptimer_timer_handle_t *handle,
+                                                   uint32_t *time);
+sl_status_t sl_sleeptimer_get_remaining_time_of_first_timer(uint16_t option_flags,
+                                                            uint32_t *time_remaining);
+uint32_t sl_sleeptimer_get_tick_count(void);
+uint64_t sl_sleeptimer_get_tick_count64(void);
+uint32_t sl_sleeptimer_get_timer_frequency(void);
+
+sl_sleeptimer_timestamp_t sl_sleeptimer_get_time(void);
+sl_status_t sl_sleeptimer_set_time(sl_sleeptimer_timestamp_t time);
+sl_status_t sl_sleeptimer_get_datetime(sl_sleeptimer_date_t *date);
+sl_status_t sl_sleeptimer_set_datetime(sl_sleeptimer_date_t *date);
+sl_status_t sl_sleeptimer_build_datetime(sl_sleeptimer_date_t *date,
+                                         uint16_t year,
+                                         sl_sleeptimer_month_t month,
+                                         uint8_t month_day,
+                                         uint8_t hour,
+                                         uint8_t min,
+                                         uint8_t sec,
+                                         sl_sleeptimer_time_zone_offset_t tz_offset);
+sl_status_t sl_sleeptimer_convert_time_to_date(sl_sleeptimer_timestamp_t time,
+                                               sl_sleeptimer_time_zone_offset_t time_zone,
+                                               sl_sleeptimer_date_t *date);
+sl_status_t sl_sleeptimer_convert_date_to_time(sl_sleeptimer_date_t *date,
+                                               sl_sleeptimer_timestamp_t *time);
+uint32_t sl_sleeptimer_convert_date_to_str(char *str,
+                                           size_t size,
+                                           const uint8_t *format,
+                                           sl_sleeptimer_date_t *date);
+void sl_sleeptimer_set_tz(sl_sleeptimer_time_zone_offset_t offset);
+sl_sleeptimer_time_zone_offset_t sl_sleeptimer_get_tz(void);
+sl_status_t sl_sleeptimer_convert_unix_time_to_ntp(sl_sleeptimer_timestamp_t time,
+                                                   uint32_t *ntp_time);
+sl_status_t sl_sleeptimer_convert_ntp_time_to_unix(uint32_t ntp_time,
+                                                   sl_sleeptimer_timestamp_t *time);
+sl_status_t sl_sleeptimer_convert_unix_time_to_zigbee(sl_sleeptimer_timestamp_t time,
+                                                      uint32_t *zigbee_time);
+sl_status_t sl_sleeptimer_convert_zigbee_time_to_unix(uint32_t zigbee_time,
+                                                      sl_sleeptimer_timestamp_t *time);
+
+void sl_sleeptimer_delay_millisecond(uint16_t time_ms);
+uint32_t sl_sleeptimer_ms_to_tick(uint16_t time_ms);
+sl_status_t sl_sleeptimer_ms32_to_tick(uint32_t time_ms,
+                                       uint32_t *tick);
+uint32_t sl_sleeptimer_get_max_ms32_conversion(void);
+uint32_t sl_sleeptimer_tick_to_ms(uint32_t tick);
+sl_status_t sl_sleeptimer_tick64_to_ms(uint64_t tick,
+                                       uint64_t *ms);
+
+__STATIC_INLINE sl_status_t sl_sleeptimer_start_timer_ms(sl_sleeptimer_timer_handle_t *handle,
+                                                         uint32_t timeout_ms,
+                                                         sl_sleeptimer_timer_callback_t callback,
+                                                         void *callback_data,
+                                                         uint8_t priority,
+                                                         uint16_t option_flags)
+{
+  uint32_t timeout;
+  sl_status_t status = sl_sleeptimer_ms32_to_tick(timeout_ms, &timeout);
+
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  return sl_sleeptimer_start_timer(handle, timeout, callback, callback_data,
+                                   priority, option_flags);
+}
+
+__STATIC_INLINE sl_status_t sl_sleeptimer_restart_timer_ms(sl_sleeptimer_timer_handle_t *handle,
+                                                           uint32_t timeout_ms,
+                                                           sl_sleeptimer_timer_callback_t callback,
+                                                           void *callback_data,
+                                                           uint8_t priority,
+                                                           uint16_t option_flags)
+{
+  uint32_t timeout;
+  sl_status_t status = sl_sleeptimer_ms32_to_tick(timeout_ms, &timeout);
+
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  return sl_sleeptimer_restart_timer(handle, timeout, callback, callback_data,
+                                     priority, option_flags);
+}
+
+__STATIC_INLINE sl_status_t sl_sleeptimer_start_periodic_timer_ms(sl_sleeptimer_timer_handle_t *handle,
+                                                                  uint32_t timeout_ms,
+                                                                  sl_sleeptimer_timer_callback_t callback,
+                                                                  void *callback_data,
+                                                                  uint8_t priority,
+                                                                  uint16_t option_flags)
+{
+  uint32_t timeout;
+  sl_status_t status = sl_sleeptimer_ms32_to_tick(timeout_ms, &timeout);
+
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  return sl_sleeptimer_start_periodic_timer(handle, timeout, callback,
+                                            callback_data, priority,
+                                            option_flags);
+}
+
+__STATIC_INLINE sl_status_t sl_sleeptimer_restart_periodic_timer_ms(sl_sleeptimer_timer_handle_t *handle,
+                                                                    uint32_t timeout_ms,
+                                                                    sl_sleeptimer_timer_callback_t callback,
+                                                                    void *callback_data,
+                                                                    uint8_t priority,
+                                                                    uint16_t option_flags)
+{
+  uint32_t timeout;
+  sl_status_t status = sl_sleeptimer_ms32_to_tick(timeout_ms, &timeout);
+
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  return sl_sleeptimer_restart_periodic_timer(handle, timeout, callback,
+                                              callback_data, priority,
+                                              option_flags);
+}
+
+#endif /* SL_SLEEPTIMER_H */
@@ -0,0 +1,29 @@
+/*
+ * sl_sleeptimer_hal.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the Gecko SDK header of the same name, implemented by
+// service/sl_sleeptimer_hal_sim.c.
+
+#ifndef SL_SLEEPTIMER_HAL_H
+#define SL_SLEEPTIMER_HAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SLEEPTIMER_EVENT_OF   (0x01)
+#define SLEEPTIMER_EVENT_COMP (0x02)
+
+void sleeptimer_hal_init_timer(void);
+uint32_t sleeptimer_hal_get_counter(void);
+uint32_t sleeptimer_hal_get_compare(void);
+void sleeptimer_hal_set_compare(uint32_t value);
+void sleeptimer_hal_enable_int(uint8_t local_flag);
+void sleeptimer_hal_disable_int(uint8_t local_flag);
+bool sleeptimer_hal_is_int_status_set(uint8_t local_flag);
+uint32_t sleeptimer_hal_get_timer_frequency(void);
+void process_timer_irq(uint8_t local_flag);
+
+#endif /* SL_SLEEPTIMER_HAL_H */
@@ -0,0 +1,29 @@
+/*
+ * sl_status.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Host stand-in for the Gecko SDK header of the same name.
+
+#ifndef SL_STATUS_H
+#define SL_STATUS_H
+
+#include <stdint.h>
+
+typedef uint32_t sl_status_t;
+
+#define SL_STATUS_OK                ((sl_status_t)0x0000)
+#define SL_STATUS_FAIL              ((sl_status_t)0x0001)
+#define SL_STATUS_INVALID_STATE     ((sl_status_t)0x0002)
+#define SL_STATUS_NOT_READY         ((sl_status_t)0x0003)
+#define SL_STATUS_BUSY              ((sl_status_t)0x0004)
+#define SL_STATUS_NOT_SUPPORTED     ((sl_status_t)0x000F)
+#define SL_STATUS_NOT_INITIALIZED   ((sl_status_t)0x0011)
+#define SL_STATUS_EMPTY             ((sl_status_t)0x001B)
+#define SL_STATUS_FULL              ((sl_status_t)0x001C)
+#define SL_STATUS_INVALID_PARAMETER ((sl_status_t)0x0021)
+#define SL_STATUS_NULL_POINTER      ((sl_status_t)0x0022)
+#define SL_STATUS_INVALID_CONFIGURATION ((sl_status_t)0x0023)
+
+#endif /* SL_STATUS_H */
@@ -0,0 +1,38 @@
+/*
+ * check.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+// Minimal assertions for the host tests: a failed CHECK prints where and
+// why, the first CHECK_PRINT_MAX times, and counts. CHECK_Done() gives the
+// exit status.
+
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <stdio.h>
+
+#define CHECK_PRINT_MAX 10
+
+static unsigned long check_failures = 0;
+static unsigned long check_count = 0;
+
+#define CHECK(cond, ...)                                                 \
+	do {                                                                 \
+		check_count++;                                                   \
+		if (!(cond)) {                                                   \
+			if (check_failures++ < CHECK_PRINT_MAX) {                    \
+				fprintf(stderr, "%s:%d: ", __FILE__, __LINE__);          \
+				fprintf(stderr, __VA_ARGS__);                            \
+				fputc('\n', stderr);                                     \
+			}                                                            \
+		}                                                                \
+	} while (0)
+
+static inline int CHECK_Done(const char *name) {
+	printf("%s: %lu checks, %lu failed\n", name, check_count, check_failures);
+	return check_failures != 0;
+}
+
+#endif /* CHECK_H */
@@ -0,0 +1,115 @@
+/*
+ * test_adjust.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "clock_control.h"
+#include "check.h"
+
+// Steps every field of the time adjust page up and down on every day from
+// 1970 to the end of the seconds counter in 2106, at a few times of the day,
+// and compares adjustOffset with the same edit done on a struct tm and
+// converted back with timegm.
+
+static const uint32_t times_of_day[] = { 0, 59, 3599, 12 * 3600 + 34 * 60 + 56,
+		23 * 3600 + 59 * 60 + 59 };
+
+static const char *const field_names[] = { "hour", "minute", "second", "day",
+		"month", "year" };
+
+static int step(int value, int count, OperationType operation) {
+	if (operation == INCR) {
+		return (value + 1) % count;
+	}
+	return (value + count - 1) % count;
+}
+
+// day 0 of the next month is the last day of this one
+static int month_days(int year, int mon) {
+	struct tm tm = { 0 };
+	time_t tt;
+
+	tm.tm_year = year;
+	tm.tm_mon = mon + 1;
+	tm.tm_mday = 0;
+	tt = timegm(&tm);
+	gmtime_r(&tt, &tm);
+	return tm.tm_mday;
+}
+
+/***************************************************************************//**
+ * @brief Returns the offset adjustOffset should give, from struct tm and
+ *        timegm only.
+ ******************************************************************************/
+static int64_t reference(uint32_t time, TimeType type, OperationType operation) {
+	time_t tt = time;
+	struct tm tm;
+	int64_t result;
+	int days;
+
+	gmtime_r(&tt, &tm);
+	switch (type) {
+	case HOUR:
+		tm.tm_hour = step(tm.tm_hour, 24, operation);
+		break;
+	case MINUTE:
+		tm.tm_min = step(tm.tm_min, 60, operation);
+		break;
+	case SECOND:
+		tm.tm_sec = step(tm.tm_sec, 60, operation);
+		break;
+	case DAY:
+		days = month_days(tm.tm_year, tm.tm_mon);
+		tm.tm_mday = step(tm.tm_mday - 1, days, operation) + 1;
+		break;
+	case MONTH:
+		tm.tm_mon = step(tm.tm_mon, 12, operation);
+		break;
+	case YEAR:
+		tm.tm_year += (operation == INCR) ? 1 : -1;
+		break;
+	}
+	days = month_days(tm.tm_year, tm.tm_mon);
+	if (tm.tm_mday > days) {
+		tm.tm_mday = days;
+	}
+
+	result = timegm(&tm);
+	if (result < 0 || result > UINT32_MAX) {
+		return 0;
+	}
+	return result - time;
+}
+
+int main(void) {
+	uint32_t days = 0;
+
+	for (uint64_t day = 0; day * 86400 <= UINT32_MAX; day++, days++) {
+		for (uint32_t i = 0; i < sizeof(times_of_day) / sizeof(times_of_day[0]);
+				i++) {
+			uint64_t time = day * 86400 + times_of_day[i];
+
+			if (time > UINT32_MAX) {
+				break;
+			}
+			for (TimeType type = HOUR; type <= YEAR; type++) {
+				for (OperationType op = INCR; op <= DECR; op++) {
+					int64_t expected = reference(time, type, op);
+					int32_t offset = adjustOffset(time, type, op);
+
+					CHECK(offset == expected, "%lu %s %s: %d, not %ld",
+							(unsigned long ) time, field_names[type],
+							op == INCR ? "up" : "down", offset, (long ) expected);
+				}
+			}
+		}
+	}
+	CHECK(days == 49711, "%u days", days);
+	return CHECK_Done("adjust");
+}
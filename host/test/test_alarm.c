@@ -0,0 +1,106 @@
+/*
+ * test_alarm.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "clock_control.h"
+#include "alarm.h"
+#include "check.h"
+
+// Setting the time rebuilds the alarm table: an alarm at the very second the
+// clock was set to must still ring, a pending snooze moves with the clock,
+// and a repeating alarm that already rang goes back on its schedule.
+
+// 2026-10-16 07:59:30
+#define START_SECOND 1792137570u
+#define EIGHT        (START_SECOND + 30)
+
+static Alarm make_alarm(uint32_t time_of, uint8_t type, uint8_t days) {
+	Alarm alarm = { 0 };
+
+	alarm.time_of = time_of;
+	alarm.type = type;
+	alarm.days = days;
+	alarm.enabled = true;
+	alarm.ring_seconds = ALARM_RING_SECONDS;
+	return alarm;
+}
+
+static void store(uint32_t index, const Alarm *alarm, uint32_t now) {
+	Time t = GetCurrTime(now);
+
+	ALARM_Store(index, alarm, now, &t);
+}
+
+static int32_t due(uint32_t now) {
+	Time t = GetCurrTime(now);
+
+	return ALARM_Due(now, &t);
+}
+
+static void rebuild(uint32_t now, int32_t shift) {
+	Time t = GetCurrTime(now);
+
+	ALARM_Rebuild(now, &t, shift);
+}
+
+static void set_to_alarm_second(void) {
+	Alarm alarm = make_alarm(8 * 3600, SIMPLE, 0);
+
+	ALARM_Init();
+	store(0, &alarm, START_SECOND);
+	rebuild(EIGHT, EIGHT - START_SECOND);
+	CHECK(ALARM_Get(0).next_fire == EIGHT, "next_fire %u",
+			ALARM_Get(0).next_fire);
+	CHECK(due(EIGHT) == 0, "not due at the second it was set to");
+}
+
+static void snooze_moves_with_clock(int32_t shift) {
+	Alarm alarm = make_alarm(8 * 3600, SIMPLE, 0);
+	uint32_t snoozed_at = EIGHT + 10;
+	uint32_t fire = snoozed_at + ALARM_SNOOZE_SECONDS + shift;
+
+	ALARM_Init();
+	store(0, &alarm, START_SECOND);
+	CHECK(due(EIGHT) == 0, "not due");
+	ALARM_Snooze(0, snoozed_at);
+	rebuild(snoozed_at + shift, shift);
+	CHECK(ALARM_Get(0).next_fire == fire, "shift %d: next_fire %u, not %u",
+			shift, ALARM_Get(0).next_fire, fire);
+	CHECK(due(fire - 1) == -1, "shift %d: early", shift);
+	CHECK(due(fire) == 0, "shift %d: snooze lost", shift);
+}
+
+static void rang_after_snooze_back_on_schedule(void) {
+	Alarm alarm = make_alarm(8 * 3600, REPEATABLE, 0x7F);
+	uint32_t snooze_fire = EIGHT + ALARM_SNOOZE_SECONDS;
+
+	ALARM_Init();
+	store(0, &alarm, START_SECOND);
+	CHECK(due(EIGHT) == 0, "not due");
+	// reschedules for tomorrow, not for the second it rang
+	CHECK(ALARM_Get(0).next_fire == EIGHT + 86400, "next_fire %u",
+			ALARM_Get(0).next_fire);
+	ALARM_Snooze(0, EIGHT);
+	CHECK(due(snooze_fire) == 0, "snooze not due");
+	CHECK(ALARM_Get(0).next_fire == EIGHT + 86400, "next_fire %u",
+			ALARM_Get(0).next_fire);
+	// back an hour before today's alarm: it rings again today at 8:00
+	rebuild(snooze_fire - 3600, -3600);
+	CHECK(ALARM_Get(0).next_fire == EIGHT, "next_fire %u",
+			ALARM_Get(0).next_fire);
+}
+
+int main(void) {
+	set_to_alarm_second();
+	snooze_moves_with_clock(3600);
+	snooze_moves_with_clock(-7200);
+	snooze_moves_with_clock(0);
+	rang_after_snooze_back_on_schedule();
+	return CHECK_Done("alarm");
+}
@@ -0,0 +1,128 @@
+/*
+ * test_calendar.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "clock_control.h"
+#include "check.h"
+
+// Walks a calendar second by second with CalendarTick from 1970 to the end
+// of the seconds counter in 2106, across the 2000 (leap) and 2100 (not leap)
+// century years, and compares it with GetCurrTime and gmtime_r. Then starts
+// calendars at random seconds with CalendarSet and ticks them on.
+
+#define RANDOM_STARTS 200000
+#define RANDOM_TICKS  100
+
+static bool same_time(const Time *a, const Time *b) {
+	return a->tm_sec == b->tm_sec && a->tm_min == b->tm_min
+			&& a->tm_hour == b->tm_hour && a->tm_mday == b->tm_mday
+			&& a->tm_mon == b->tm_mon && a->tm_year == b->tm_year
+			&& a->tm_wday == b->tm_wday;
+}
+
+// tm_wday counts from Sunday, Time.tm_wday from Monday
+static bool same_as_gmtime(uint32_t sec, const Time *t) {
+	time_t tt = sec;
+	struct tm tm;
+
+	gmtime_r(&tt, &tm);
+	return t->tm_sec == (uint32_t) tm.tm_sec && t->tm_min == (uint32_t) tm.tm_min
+			&& t->tm_hour == (uint32_t) tm.tm_hour
+			&& t->tm_mday == (uint32_t) tm.tm_mday
+			&& t->tm_mon == (uint32_t) tm.tm_mon + 1
+			&& t->tm_year == tm.tm_year + 1900
+			&& t->tm_wday == (tm.tm_wday + 6) % 7;
+}
+
+static void check_calendar(const Calendar *cal) {
+	Time expected = GetCurrTime(cal->sec);
+
+	CHECK(same_time(&cal->time, &expected),
+			"%u: calendar %04d-%02u-%02u %02u:%02u:%02u wday %d", cal->sec,
+			cal->time.tm_year, cal->time.tm_mon, cal->time.tm_mday,
+			cal->time.tm_hour, cal->time.tm_min, cal->time.tm_sec,
+			cal->time.tm_wday);
+	CHECK(same_as_gmtime(cal->sec, &cal->time), "%u: differs from gmtime_r",
+			cal->sec);
+}
+
+/***************************************************************************//**
+ * @brief Every second is ticked. The full comparison runs once an hour and on
+ *        every second of the minute either side of midnight, where the day,
+ *        month and year carry.
+ ******************************************************************************/
+static void walk(void) {
+	Calendar cal;
+	uint32_t leap_days = 0;
+
+	CalendarSet(&cal, 0);
+	for (;;) {
+		const Time *t = &cal.time;
+
+		if ((t->tm_min == 0 && (t->tm_sec == 0 || t->tm_hour == 0))
+				|| (t->tm_hour == 23 && t->tm_min == 59)) {
+			check_calendar(&cal);
+		}
+		if (t->tm_mon == 2 && t->tm_mday == 29 && t->tm_hour == 0
+				&& t->tm_min == 0 && t->tm_sec == 0) {
+			leap_days++;
+			CHECK(t->tm_year % 4 == 0 && t->tm_year != 2100,
+					"29 February %d", t->tm_year);
+		}
+		if (cal.sec == UINT32_MAX) {
+			break;
+		}
+		CalendarTick(&cal);
+	}
+	check_calendar(&cal);
+	// 1972 to 2104
+	CHECK(leap_days == 33, "%u leap days", leap_days);
+	CHECK(cal.time.tm_year == 2106 && cal.time.tm_mon == 2
+			&& cal.time.tm_mday == 7, "ends on %04d-%02u-%02u",
+			cal.time.tm_year, cal.time.tm_mon, cal.time.tm_mday);
+}
+
+static uint32_t xorshift(uint32_t *state) {
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return *state = x;
+}
+
+static void random_starts(void) {
+	uint32_t seed = 0x2026u;
+
+	for (uint32_t i = 0; i < RANDOM_STARTS; i++) {
+		Calendar cal;
+		uint32_t start = xorshift(&seed);
+
+		// some starts just before a midnight
+		if (i & 1) {
+			start -= start % 86400 + RANDOM_TICKS / 2;
+		}
+		if (start > UINT32_MAX - RANDOM_TICKS) {
+			continue;
+		}
+		CalendarSet(&cal, start);
+		check_calendar(&cal);
+		for (uint32_t tick = 0; tick < RANDOM_TICKS; tick++) {
+			CalendarTick(&cal);
+		}
+		check_calendar(&cal);
+	}
+}
+
+int main(void) {
+	walk();
+	random_starts();
+	return CHECK_Done("calendar");
+}
@@ -0,0 +1,99 @@
+/*
+ * test_date64.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "sl_sleeptimer.h"
+#include "sl_sleeptimer_wallclock64.h"
+#include "check.h"
+
+// Converts a million random millisecond timestamps up to the end of year 9999
+// to dates, in random time zones, and checks them against gmtime_r and back
+// with sl_sleeptimer_convert_date_to_time_ms64.
+
+#define SAMPLES   1000000
+// 9999-12-31 23:59:59.999
+#define MS_MAX    253402300799999ull
+#define TZ_MIN    (-12 * 3600)
+#define TZ_MAX    (14 * 3600)
+
+static uint64_t xorshift64(uint64_t *state) {
+	uint64_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	return *state = x;
+}
+
+// day_of_year counts from 1, tm_yday from 0
+static bool same_as_tm(const sl_sleeptimer_date_t *date, const struct tm *tm) {
+	return date->sec == tm->tm_sec && date->min == tm->tm_min
+			&& date->hour == tm->tm_hour && date->month_day == tm->tm_mday
+			&& date->month == tm->tm_mon && date->year == tm->tm_year
+			&& date->day_of_week == tm->tm_wday
+			&& date->day_of_year == tm->tm_yday + 1;
+}
+
+static void check_ms(uint64_t time_ms, int32_t time_zone) {
+	sl_sleeptimer_date_t date;
+	uint16_t ms;
+	uint64_t back;
+	time_t local;
+	struct tm tm;
+
+	if ((int64_t) time_ms + (int64_t) time_zone * 1000 < 0
+			|| time_ms + (int64_t) time_zone * 1000 > MS_MAX) {
+		CHECK(sl_sleeptimer_convert_time_ms64_to_date(time_ms, time_zone,
+				&date, &ms) == SL_STATUS_INVALID_PARAMETER,
+				"%llu%+d: out of range accepted", (unsigned long long) time_ms,
+				time_zone);
+		return;
+	}
+
+	CHECK(sl_sleeptimer_convert_time_ms64_to_date(time_ms, time_zone, &date,
+			&ms) == SL_STATUS_OK, "%llu%+d: refused",
+			(unsigned long long) time_ms, time_zone);
+	local = (time_t) (time_ms / 1000) + time_zone;
+	gmtime_r(&local, &tm);
+	CHECK(same_as_tm(&date, &tm) && ms == time_ms % 1000,
+			"%llu%+d: %u-%02u-%02u %02u:%02u:%02u.%03u wday %u yday %u",
+			(unsigned long long) time_ms, time_zone, date.year + 1900,
+			date.month + 1, date.month_day, date.hour, date.min, date.sec, ms,
+			date.day_of_week, date.day_of_year);
+
+	CHECK(sl_sleeptimer_convert_date_to_time_ms64(&date, &back) == SL_STATUS_OK
+			&& back == time_ms - ms, "%llu%+d: back to %llu",
+			(unsigned long long) time_ms, time_zone, (unsigned long long) back);
+}
+
+int main(void) {
+	uint64_t seed = 0x9999;
+	sl_sleeptimer_date_t date;
+
+	for (uint32_t i = 0; i < SAMPLES; i++) {
+		uint64_t r = xorshift64(&seed);
+		// a quarter within 32 bits of seconds, UTC every other time
+		uint64_t time_ms = (i & 3) ? r % (MS_MAX + 1) : r % (1000ull << 31);
+		int32_t time_zone = (i & 1) ? 0 :
+				TZ_MIN + (int32_t) ((r >> 40) % (TZ_MAX - TZ_MIN + 1));
+
+		check_ms(time_ms, time_zone);
+	}
+
+	// both ends of the range
+	check_ms(0, 0);
+	check_ms(0, TZ_MIN);
+	check_ms(MS_MAX, 0);
+	check_ms(MS_MAX, 1);
+	check_ms(MS_MAX - 999, TZ_MIN);
+	CHECK(sl_sleeptimer_convert_time_ms64_to_date(MS_MAX + 1, 0, &date, NULL)
+			== SL_STATUS_INVALID_PARAMETER, "year 10000 accepted");
+	return CHECK_Done("date64");
+}
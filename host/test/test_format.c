@@ -0,0 +1,145 @@
+/*
+ * test_format.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+
+#include "clock_control.h"
+#include "format.h"
+#include "check.h"
+
+// Compares every formatter of format.c with the same output made by
+// snprintf (and strftime for the names): all two-digit values, integers
+// around every power of ten and at random, every milli-unit value out to
+// beyond the saturation, and the times and dates of random seconds. Each
+// returned end must point at the terminator.
+
+#define INT_RANDOM  10000000
+#define MILLI_RANGE 120000
+#define MILLI_MAX   99999
+#define SECONDS     1000000
+
+static uint32_t xorshift(uint32_t *state) {
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return *state = x;
+}
+
+static void check_same(const char *what, const char *buf, const char *end,
+		const char *expected) {
+	CHECK(strcmp(buf, expected) == 0, "%s: \"%s\", snprintf \"%s\"", what,
+			buf, expected);
+	CHECK(end == buf + strlen(buf), "%s \"%s\": end at %d", what, buf,
+			(int) (end - buf));
+}
+
+static void check_int(int32_t value) {
+	char buf[16];
+	char expected[16];
+
+	snprintf(expected, sizeof(expected), "%d", value);
+	check_same("int", buf, FORMAT_Int(buf, value), expected);
+}
+
+static void two_digits_and_ints(void) {
+	uint32_t seed = 0x2026u;
+	char buf[16];
+	char expected[16];
+
+	for (uint32_t value = 0; value < 100; value++) {
+		snprintf(expected, sizeof(expected), "%02u", value);
+		check_same("two digits", buf, FORMAT_TwoDigits(buf, value), expected);
+	}
+
+	check_int(INT32_MIN);
+	check_int(INT32_MAX);
+	// both reciprocals of FORMAT_Int and the switch between them
+	for (int32_t value = 0; value < (1 << 18); value++) {
+		check_int(value);
+	}
+	for (int64_t power = 1; power <= 1000000000; power *= 10) {
+		for (int32_t d = -2; d <= 2; d++) {
+			check_int((int32_t) (power + d));
+			check_int((int32_t) (-power + d));
+		}
+	}
+	for (uint32_t i = 0; i < INT_RANDOM; i++) {
+		check_int((int32_t) xorshift(&seed));
+	}
+}
+
+static void milli(void) {
+	char buf[16];
+	char expected[16];
+
+	for (int32_t m = -MILLI_RANGE; m <= MILLI_RANGE; m++) {
+		uint32_t value = (m < 0) ? (uint32_t) -m : (uint32_t) m;
+
+		if (value > MILLI_MAX) {
+			value = MILLI_MAX;
+		}
+		snprintf(expected, sizeof(expected), "%c%2u.%u", (m < 0) ? '-' : ' ',
+				value / 1000, (value / 100) % 10);
+		check_same("milli1", buf, FORMAT_Milli1(buf, m), expected);
+
+		snprintf(expected, sizeof(expected), "%s%02u.%02u", (m < 0) ? "-" : "",
+				value / 1000, (value / 10) % 100);
+		check_same("milli2", buf, FORMAT_Milli2(buf, m), expected);
+	}
+}
+
+static void times_and_names(void) {
+	uint32_t seed = 0x1970u;
+	char buf[16];
+	char expected[32];
+
+	for (uint32_t i = 0; i < SECONDS; i++) {
+		uint32_t sec = xorshift(&seed);
+		time_t tt = sec;
+		Time t = GetCurrTime(sec);
+		struct tm tm;
+
+		gmtime_r(&tt, &tm);
+		snprintf(expected, sizeof(expected), "%02d:%02d:%02d", tm.tm_hour,
+				tm.tm_min, tm.tm_sec);
+		check_same("time", buf, FORMAT_Time(buf, &t), expected);
+		snprintf(expected, sizeof(expected), "%02d/%02d/%d", tm.tm_mday,
+				tm.tm_mon + 1, tm.tm_year + 1900);
+		check_same("date", buf, FORMAT_Date(buf, &t), expected);
+	}
+
+	for (uint32_t mon = 1; mon <= 12; mon++) {
+		struct tm tm = { .tm_mon = mon - 1 };
+
+		strftime(expected, sizeof(expected), "%b", &tm);
+		for (char *c = expected; *c != '\0'; c++) {
+			*c = toupper((unsigned char) *c);
+		}
+		check_same("month", buf, FORMAT_Month(buf, mon), expected);
+	}
+	for (Day day = MON; day <= SUN; day++) {
+		// tm_wday counts from Sunday
+		struct tm tm = { .tm_wday = (day + 1) % 7 };
+
+		strftime(expected, sizeof(expected), "%a", &tm);
+		expected[1] = '\0';
+		check_same("day", buf, FORMAT_DayLetter(buf, day), expected);
+	}
+}
+
+int main(void) {
+	two_digits_and_ints();
+	milli();
+	times_and_names();
+	return CHECK_Done("format");
+}
@@ -0,0 +1,125 @@
+/*
+ * test_glyph.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "em_types.h"
+#include "dmd.h"
+#include "glib.h"
+#include "extra_fonts.h"
+#include "glyph.h"
+#include "sim.h"
+#include "check.h"
+
+// Draws 200000 random strings with GLYPH_DrawString twice, once through the
+// frame buffer path and once through GLIB, one rectangle per run of pixels,
+// and checks that both leave the same pixels. Fonts, scales, positions
+// (partly off the panel too), clipping regions, colours and the opaque flag
+// are random, and every draw starts from a random frame so that transparent
+// glyphs must keep what they do not cover.
+
+#define STRINGS    200000
+#define LENGTH_MAX 12
+#define FRAME_SIZE (SIM_PANEL_HEIGHT * SIM_PANEL_ROW_BYTES)
+
+static const GLIB_Font_t *const fonts[] = { &GLIB_fontCustom,
+		&GLIB_font7Segment, &GLIB_FontNarrow6x8, &GLIB_FontNormal8x8 };
+
+// glyph.c takes the frame buffer from here, NULL draws through GLIB
+static bool frame_path;
+
+uint8_t *LCD_GetFrame(void) {
+	return frame_path ? SIM_DmdFrame() : NULL;
+}
+
+static uint32_t xorshift(uint32_t *state) {
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return *state = x;
+}
+
+static int32_t random_in(uint32_t *seed, int32_t min, int32_t max) {
+	return min + (int32_t) (xorshift(seed) % (uint32_t) (max - min + 1));
+}
+
+// printable characters, some the fonts do not have, now and then a newline
+static void random_string(uint32_t *seed, char *s, uint32_t len) {
+	for (uint32_t i = 0; i < len; i++) {
+		uint32_t r = xorshift(seed) % 64;
+
+		s[i] = (r == 0) ? '\n' : (char) random_in(seed, ' ', 0x9F);
+	}
+	s[len] = '\0';
+}
+
+static void random_clip(uint32_t *seed, GLIB_Context_t *context) {
+	GLIB_Rectangle_t clip = { 0, 0, SIM_PANEL_WIDTH - 1, SIM_PANEL_HEIGHT - 1 };
+
+	if ((xorshift(seed) & 3) == 0) {
+		clip.xMin = random_in(seed, 0, 100);
+		clip.yMin = random_in(seed, 0, 100);
+		clip.xMax = random_in(seed, clip.xMin, SIM_PANEL_WIDTH - 1);
+		clip.yMax = random_in(seed, clip.yMin, SIM_PANEL_HEIGHT - 1);
+	}
+	GLIB_setClippingRegion(context, &clip);
+}
+
+int main(void) {
+	static uint8_t start[FRAME_SIZE];
+	static uint8_t by_frame[FRAME_SIZE];
+	GLIB_Context_t context;
+	uint32_t seed = 0x2026u;
+	uint32_t differing = 0;
+
+	DMD_init(NULL);
+	GLIB_contextInit(&context);
+
+	for (uint32_t n = 0; n < STRINGS; n++) {
+		const GLIB_Font_t *font = fonts[xorshift(&seed) % 4];
+		uint32_t len = random_in(&seed, 1, LENGTH_MAX);
+		uint32_t scale = random_in(&seed, 1, GLYPH_SCALE_MAX);
+		int32_t x = random_in(&seed, -24, SIM_PANEL_WIDTH + 8);
+		int32_t y = random_in(&seed, -24, SIM_PANEL_HEIGHT + 8);
+		bool opaque = xorshift(&seed) & 1;
+		char s[LENGTH_MAX + 1];
+		EMSTATUS frame_status;
+		EMSTATUS glib_status;
+
+		random_string(&seed, s, len);
+		GLIB_setFont(&context, (GLIB_Font_t*) font);
+		random_clip(&seed, &context);
+		context.foregroundColor = (xorshift(&seed) & 1) ? White : Black;
+		context.backgroundColor = (xorshift(&seed) & 1) ? White : Black;
+		for (uint32_t i = 0; i < FRAME_SIZE; i++) {
+			start[i] = (uint8_t) xorshift(&seed);
+		}
+
+		memcpy(SIM_DmdFrame(), start, FRAME_SIZE);
+		frame_path = true;
+		frame_status = GLYPH_DrawString(&context, s, len, x, y, scale, opaque);
+		memcpy(by_frame, SIM_DmdFrame(), FRAME_SIZE);
+
+		memcpy(SIM_DmdFrame(), start, FRAME_SIZE);
+		frame_path = false;
+		glib_status = GLYPH_DrawString(&context, s, len, x, y, scale, opaque);
+
+		CHECK(frame_status == glib_status, "string %u: status %d and %d", n,
+				(int) frame_status, (int) glib_status);
+		if (memcmp(by_frame, SIM_DmdFrame(), FRAME_SIZE) != 0) {
+			differing++;
+			CHECK(false, "string %u: \"%s\" at %d,%d scale %u%s differs", n, s,
+					x, y, scale, opaque ? " opaque" : "");
+		}
+	}
+	printf("%u strings, %u differing\n", STRINGS, differing);
+	return CHECK_Done("glyph");
+}
@@ -0,0 +1,247 @@
+/*
+ * test_i2c_queue.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "em_device.h"
+#include "em_emu.h"
+#include "em_i2c.h"
+#include "i2c_queue.h"
+#include "sim.h"
+#include "check.h"
+
+// Runs the I2C queue on the fake bus of sim/i2c_sim.c against a register
+// memory: writes and write-reads, retries of NACKed and lost transfers,
+// transactions queued back to back and from callbacks, and the bytes per
+// second the queue keeps the bus busy with.
+
+#define MEMORY_ADDR   0xA0
+#define ABSENT_ADDR   0x42
+#define QUEUE_DEPTH   8
+#define BLOCK         16
+#define THROUGHPUT_TX 20000
+// a start, the address, the register, the data and a stop
+#define BLOCK_BITS    (1 + 9 * (1 + 1 + BLOCK) + 1)
+
+// 256 registers, a write sets the register pointer and stores the bytes after
+// it, a read continues from the pointer
+typedef struct Memory {
+	uint8_t reg[256];
+	uint8_t pointer;
+} Memory;
+
+static Memory memory;
+static uint32_t idle_gaps;
+static uint32_t order[QUEUE_DEPTH];
+static uint32_t completed;
+
+static bool memory_write(void *ctx, const uint8_t *data, uint16_t len) {
+	Memory *m = ctx;
+
+	if (len > 0) {
+		m->pointer = data[0];
+		for (uint16_t i = 1; i < len; i++) {
+			m->reg[m->pointer++] = data[i];
+		}
+	}
+	return true;
+}
+
+static bool memory_read(void *ctx, uint8_t *data, uint16_t len) {
+	Memory *m = ctx;
+
+	for (uint16_t i = 0; i < len; i++) {
+		data[i] = m->reg[m->pointer++];
+	}
+	return true;
+}
+
+static const SimI2cDevice memory_device = { MEMORY_ADDR, memory_write,
+		memory_read, &memory };
+
+// EM1 while the queue works: the next byte's interrupt. A transaction still
+// queued with the bus idle would be a gap between two of them.
+static void idle(void) {
+	if (!SIM_I2cRun() && !I2CQ_IsIdle()) {
+		idle_gaps++;
+	}
+}
+
+static void run_bus(void) {
+	while (SIM_I2cRun()) {
+	}
+}
+
+static void record_order(I2cqTransaction *t) {
+	order[completed++] = (uint32_t) (uintptr_t) t->user;
+}
+
+static void write_read(void) {
+	uint8_t write[1 + 4] = { 0x10, 1, 2, 3, 4 };
+	uint8_t pointer = 0x10;
+	uint8_t read[4] = { 0 };
+	I2cqTransaction w = { .addr = MEMORY_ADDR, .flags = I2C_FLAG_WRITE,
+			.write = write, .writeLen = sizeof(write) };
+	I2cqTransaction r = { .addr = MEMORY_ADDR, .flags = I2C_FLAG_WRITE_READ,
+			.write = &pointer, .writeLen = 1, .read = read, .readLen =
+					sizeof(read) };
+
+	CHECK(I2CQ_Transfer(&w) == i2cTransferDone, "write %d", w.result);
+	CHECK(memcmp(&memory.reg[0x10], &write[1], 4) == 0, "memory");
+	CHECK(I2CQ_Transfer(&r) == i2cTransferDone, "write-read %d", r.result);
+	CHECK(memcmp(read, &write[1], 4) == 0, "read %u %u %u %u", read[0],
+			read[1], read[2], read[3]);
+	CHECK(I2CQ_IsIdle() && !SIM_I2cIsBusy(), "bus left busy");
+}
+
+static void retries(void) {
+	uint8_t data[2] = { 0x20, 0x55 };
+	I2cqTransaction t = { .addr = MEMORY_ADDR, .flags = I2C_FLAG_WRITE,
+			.write = data, .writeLen = sizeof(data), .retries = 2 };
+	I2cqTransaction absent = { .addr = ABSENT_ADDR, .flags = I2C_FLAG_WRITE,
+			.write = data, .writeLen = sizeof(data), .retries = 3 };
+	I2cqStats before = I2CQ_GetStats();
+	I2cqStats after;
+
+	// two NACKs, the last attempt gets through
+	SIM_I2cFail(2, i2cTransferNack);
+	CHECK(I2CQ_Transfer(&t) == i2cTransferDone, "retried %d", t.result);
+	CHECK(t.attempts == 2, "attempts %u", t.attempts);
+
+	// one more failure than retries
+	SIM_I2cFail(3, i2cTransferArbLost);
+	CHECK(I2CQ_Transfer(&t) == i2cTransferArbLost, "lost %d", t.result);
+	SIM_I2cFail(0, i2cTransferDone);
+
+	CHECK(I2CQ_Transfer(&absent) == i2cTransferNack, "absent %d",
+			absent.result);
+
+	after = I2CQ_GetStats();
+	CHECK(after.retries - before.retries == 2 + 2 + 3, "retries %u",
+			after.retries - before.retries);
+	CHECK(after.failures - before.failures == 2, "failures %u",
+			after.failures - before.failures);
+	CHECK(after.transactions - before.transactions == 3, "transactions %u",
+			after.transactions - before.transactions);
+}
+
+static void back_to_back(void) {
+	static uint8_t data[QUEUE_DEPTH][2];
+	static I2cqTransaction t[QUEUE_DEPTH];
+
+	completed = 0;
+	for (uint32_t i = 0; i < QUEUE_DEPTH; i++) {
+		data[i][0] = 0x40 + i;
+		data[i][1] = i;
+		t[i] = (I2cqTransaction ) { .addr = MEMORY_ADDR, .flags =
+						I2C_FLAG_WRITE, .write = data[i], .writeLen = 2,
+						.callback = record_order, .user = (void*) (uintptr_t) i };
+		CHECK(I2CQ_Submit(&t[i]), "submit %u", i);
+	}
+	CHECK(!I2CQ_Submit(&t[0]), "submitted twice");
+	CHECK(SIM_I2cIsBusy(), "first not started");
+
+	run_bus();
+	CHECK(completed == QUEUE_DEPTH, "completed %u", completed);
+	for (uint32_t i = 0; i < QUEUE_DEPTH; i++) {
+		CHECK(order[i] == i, "order %u: %u", i, order[i]);
+		CHECK(t[i].result == i2cTransferDone, "result %u: %d", i, t[i].result);
+		CHECK(memory.reg[0x40 + i] == i, "memory %u", i);
+	}
+}
+
+static I2cqTransaction chained;
+static uint8_t chained_data[2] = { 0x60, 0 };
+
+static void chain(I2cqTransaction *t) {
+	// submitting itself again from its own callback
+	if (++chained_data[1] < 5) {
+		I2CQ_Submit(t);
+	}
+}
+
+static void from_callback(void) {
+	chained = (I2cqTransaction ) { .addr = MEMORY_ADDR, .flags =
+					I2C_FLAG_WRITE, .write = chained_data, .writeLen = 2,
+					.callback = chain };
+	I2CQ_Submit(&chained);
+	run_bus();
+	CHECK(chained_data[1] == 5 && memory.reg[0x60] == 4, "chained %u %u",
+			chained_data[1], memory.reg[0x60]);
+	CHECK(I2CQ_IsIdle(), "chain left queued");
+}
+
+static void throughput(void) {
+	static uint8_t data[QUEUE_DEPTH][1 + BLOCK];
+	static I2cqTransaction t[QUEUE_DEPTH];
+	SimI2cStats bus_before = SIM_I2cGetStats();
+	I2cqStats before = I2CQ_GetStats();
+	SimI2cStats bus;
+	I2cqStats queue;
+	uint64_t start;
+	uint64_t ns;
+	double bus_rate;
+	double line_rate;
+
+	for (uint32_t i = 0; i < QUEUE_DEPTH; i++) {
+		t[i] = (I2cqTransaction ) { .addr = MEMORY_ADDR, .flags =
+						I2C_FLAG_WRITE, .write = data[i], .writeLen = 1 + BLOCK };
+	}
+
+	// the queue kept full, a slot submitted again as soon as it completed
+	start = SIM_NowNs();
+	for (uint32_t n = 0; n < THROUGHPUT_TX; n++) {
+		I2cqTransaction *slot = &t[n % QUEUE_DEPTH];
+
+		while (slot->queued) {
+			EMU_EnterEM1();
+		}
+		I2CQ_Submit(slot);
+	}
+	while (!I2CQ_IsIdle()) {
+		EMU_EnterEM1();
+	}
+	ns = SIM_NowNs() - start;
+
+	bus = SIM_I2cGetStats();
+	queue = I2CQ_GetStats();
+	bus.bits -= bus_before.bits;
+	bus.bytes -= bus_before.bytes;
+	queue.bytes -= before.bytes;
+
+	bus_rate = (double) bus.bytes * SIM_I2C_FREQUENCY / bus.bits;
+	line_rate = (double) (1 + BLOCK) * SIM_I2C_FREQUENCY / BLOCK_BITS;
+	printf("%u transactions of %u bytes: %.0f bytes/s on the bus at %u Hz"
+			" (%.0f without gaps), %.0f ns of host time each\n",
+			THROUGHPUT_TX, 1 + BLOCK, bus_rate, SIM_I2C_FREQUENCY, line_rate,
+			(double) ns / THROUGHPUT_TX);
+
+	CHECK(queue.bytes == (uint32_t) THROUGHPUT_TX * (1 + BLOCK),
+			"queue bytes %u", queue.bytes);
+	CHECK(bus.bytes == queue.bytes, "bus bytes %u", bus.bytes);
+	CHECK(bus.bits == (uint64_t) THROUGHPUT_TX * BLOCK_BITS, "bus bits %llu",
+			(unsigned long long) bus.bits);
+	CHECK(bus_rate >= line_rate * 0.999, "%.0f bytes/s", bus_rate);
+}
+
+int main(void) {
+	SIM_I2cReset();
+	SIM_I2cAttach(&memory_device);
+	SIM_SetIdleHook(idle);
+	I2CQ_Init(I2C0);
+
+	write_read();
+	retries();
+	back_to_back();
+	from_callback();
+	throughput();
+
+	CHECK(idle_gaps == 0, "bus idle with %u transactions queued", idle_gaps);
+	return CHECK_Done("i2c queue");
+}
@@ -0,0 +1,138 @@
+/*
+ * test_sensor.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "em_device.h"
+#include "sl_sleeptimer.h"
+#include "sl_sleeptimer_hal_sim.h"
+#include "si7013.h"
+#include "clock_control.h"
+#include "event_queue.h"
+#include "i2c_queue.h"
+#include "sensor.h"
+#include "sim.h"
+#include "check.h"
+
+// Measures with a simulated Si7021 whose conversion takes from nothing to
+// longer than the driver waits. The measurement must not hold the core or
+// the bus while the sensor converts, must poll a slow sensor until it
+// answers and end with a timestamped EVENT_SAMPLE, or without an event once
+// the polls ran out.
+
+typedef struct Case {
+	uint32_t conversion_ms;
+	uint32_t early_reads; // reads before the conversion ended
+	bool ok;
+} Case;
+
+// the first read after SENSOR_CONVERSION_MS, then every SENSOR_POLL_MS
+static const Case cases[] = { { 0, 0, true }, { 12, 0, true },
+		{ 22, 0, true }, { 24, 1, true }, { 26, 2, true }, { 30, 4, true },
+		{ 32, SENSOR_POLL_MAX, false }, { 40, SENSOR_POLL_MAX, false } };
+
+#define RH_STEP   8  // milli-percent per step of the 14-bit word
+#define TEMP_STEP 11 // milli-degrees per step
+// timer rounding, the 2 ms polls chained on each other
+#define LATE_MAX  4
+
+static uint32_t bus_ticks;
+
+// EM1 while a transfer is on the bus, EM2 otherwise
+static void idle(void) {
+	if (SIM_I2cRun()) {
+		return;
+	}
+	if (SIM_I2cIsBusy()) {
+		bus_ticks++;
+	}
+	sl_sleeptimer_hal_sim_advance(1);
+}
+
+static void measure(const Case *c, uint32_t index) {
+	uint32_t rh = 40000 + index * 1234;
+	int32_t temp = -5000 + (int32_t) index * 4321;
+	uint32_t errors = SENSOR_GetErrorCount();
+	SimSi7021Stats before = SIM_Si7021GetStats();
+	uint32_t start;
+	uint32_t elapsed;
+	uint32_t expected;
+	SensorSample sample;
+	Event event;
+	bool sampled = false;
+
+	SIM_Si7021SetConversion(c->conversion_ms);
+	SIM_Si7021Set(rh, temp);
+
+	start = sl_sleeptimer_get_tick_count();
+	CHECK(SENSOR_Start(), "%u ms: not started", c->conversion_ms);
+	CHECK(sl_sleeptimer_get_tick_count() == start, "%u ms: start blocked",
+			c->conversion_ms);
+	CHECK(!SENSOR_Start(), "%u ms: started twice", c->conversion_ms);
+	while (SENSOR_IsBusy()) {
+		idle();
+	}
+	elapsed = sl_sleeptimer_get_tick_count() - start;
+
+	while (EVENTS_Pop(&event)) {
+		if (event.type == EVENT_SAMPLE) {
+			sampled = true;
+			CHECK(event.data == CLOCK_Get(NULL), "%u ms: stamped %u",
+					c->conversion_ms, event.data);
+		}
+	}
+	CHECK(sampled == c->ok, "%u ms: sample %d", c->conversion_ms, sampled);
+	CHECK(SENSOR_GetErrorCount() - errors == (c->ok ? 0 : 1), "%u ms: errors",
+			c->conversion_ms);
+	// the RH read and the temperature read behind it, each NACKed
+	CHECK(SIM_Si7021GetStats().nacks - before.nacks == 2 * c->early_reads,
+			"%u ms: %u NACKs", c->conversion_ms,
+			SIM_Si7021GetStats().nacks - before.nacks);
+
+	expected = sl_sleeptimer_ms_to_tick(
+			SENSOR_CONVERSION_MS
+					+ (c->early_reads - (c->ok ? 0 : 1)) * SENSOR_POLL_MS);
+	CHECK(elapsed >= expected && elapsed <= expected + LATE_MAX,
+			"%u ms: took %u ticks, %u expected", c->conversion_ms, elapsed,
+			expected);
+
+	if (c->ok) {
+		CHECK(SENSOR_GetSample(&sample), "%u ms: no sample", c->conversion_ms);
+		CHECK(sample.rh >= rh && sample.rh <= rh + RH_STEP,
+				"%u ms: rh %u for %u", c->conversion_ms, sample.rh, rh);
+		CHECK(sample.temp >= temp && sample.temp <= temp + TEMP_STEP,
+				"%u ms: temp %d for %d", c->conversion_ms, sample.temp, temp);
+	}
+	printf("%2u ms conversion: %s after %5.1f ms, %u NACKed reads\n",
+			c->conversion_ms, c->ok ? "sample" : "error ",
+			elapsed * 1000.0 / sl_sleeptimer_get_timer_frequency(),
+			c->early_reads);
+
+	// let a conversion the driver gave up on finish
+	sl_sleeptimer_hal_sim_advance(sl_sleeptimer_ms_to_tick(100));
+}
+
+int main(void) {
+	sl_sleeptimer_init();
+	CLOCK_Init();
+	EVENTS_Init();
+	SIM_SetIdleHook(idle);
+	SIM_I2cReset();
+	I2CQ_Init(I2C0);
+	SENSOR_Init(SI7021_ADDR);
+
+	CHECK(!SENSOR_Detect(), "detected without a sensor");
+	SIM_Si7021Attach(SENSOR_CONVERSION_MS);
+	CHECK(SENSOR_Detect(), "not detected");
+
+	for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+		measure(&cases[i], i);
+	}
+	CHECK(bus_ticks == 0, "bus held for %u ticks", bus_ticks);
+	return CHECK_Done("sensor");
+}
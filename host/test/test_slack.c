@@ -0,0 +1,106 @@
+/*
+ * test_slack.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "sl_sleeptimer.h"
+#include "sl_sleeptimer_slack.h"
+#include "sl_sleeptimer_hal_sim.h"
+#include "check.h"
+
+// A timer with a slack rides along with the next wakeup of the 1 Hz tick when
+// that falls within its slack, the way sampling.c runs the measurement. A
+// timer without slack in between still runs on time and ends the wait.
+// Built against both timer stores, test_slack_wheel for the timing wheel.
+
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+#define TEST_NAME  "slack wheel"
+#else
+#define TEST_NAME  "slack"
+#endif
+
+#define SECOND     32768u
+#define TICK_START 0u
+#define SLOW_START 1000u
+#define SLOW_SLACK SECOND
+#define SECONDS    100u
+
+typedef struct Timer {
+	sl_sleeptimer_timer_handle_t handle;
+	uint32_t due;
+	uint32_t period;
+	uint32_t slack;
+	uint32_t fired;
+	uint32_t late_max;
+} Timer;
+
+static Timer tick;
+static Timer slow;
+static Timer strict;
+static uint32_t slow_fired_at;
+
+static void expired(sl_sleeptimer_timer_handle_t *handle, void *data) {
+	Timer *timer = data;
+	uint32_t late = sl_sleeptimer_get_tick_count() - timer->due;
+
+	(void) handle;
+	CHECK(late <= timer->slack, "%s timer %u ticks late",
+			timer == &tick ? "tick" : timer == &slow ? "slow" : "strict", late);
+	if (late > timer->late_max) {
+		timer->late_max = late;
+	}
+	if (timer == &slow) {
+		slow_fired_at = sl_sleeptimer_get_tick_count();
+	}
+	timer->fired++;
+	timer->due += timer->period;
+}
+
+int main(void) {
+	uint32_t irqs;
+	uint32_t strict_due;
+
+	sl_sleeptimer_init();
+
+	tick = (Timer ) { .due = TICK_START + SECOND, .period = SECOND };
+	sl_sleeptimer_start_periodic_timer(&tick.handle, SECOND, expired, &tick, 0,
+			0);
+	sl_sleeptimer_hal_sim_advance(SLOW_START);
+	slow = (Timer ) { .due = SLOW_START + 5 * SECOND, .period = 5 * SECOND,
+					.slack = SLOW_SLACK };
+	CHECK(sl_sleeptimer_start_periodic_timer_slack(&slow.handle, 5 * SECOND,
+			SLOW_SLACK, expired, &slow, 0, 0) == SL_STATUS_OK,
+			"slack refused");
+
+	irqs = sl_sleeptimer_hal_sim_get_irq_count();
+	sl_sleeptimer_hal_sim_advance(SECONDS * SECOND - SLOW_START);
+	irqs = sl_sleeptimer_hal_sim_get_irq_count() - irqs;
+
+	CHECK(tick.fired == SECONDS, "%u ticks", tick.fired);
+	CHECK(tick.late_max == 0, "tick %u late", tick.late_max);
+	CHECK(slow.fired == SECONDS / 5 - 1, "%u slow expiries", slow.fired);
+	// every slow expiry shares the wakeup of the next tick
+	CHECK(irqs == tick.fired, "%u wakeups for %u ticks", irqs, tick.fired);
+	CHECK(sl_sleeptimer_get_wakeups_avoided() == slow.fired,
+			"%u wakeups avoided", sl_sleeptimer_get_wakeups_avoided());
+
+	// a timer without slack between a slow expiry and the next tick
+	strict_due = slow.due + SECOND / 4;
+	strict = (Timer ) { .due = strict_due };
+	sl_sleeptimer_start_timer(&strict.handle,
+			strict_due - sl_sleeptimer_get_tick_count(), expired, &strict, 0, 0);
+	sl_sleeptimer_hal_sim_advance(strict_due - sl_sleeptimer_get_tick_count());
+	CHECK(strict.fired == 1 && strict.late_max == 0, "strict timer %u late",
+			strict.late_max);
+	CHECK(slow_fired_at == strict_due, "slow ran at %u, not with the strict "
+			"timer at %u", slow_fired_at, strict_due);
+
+	sl_sleeptimer_stop_timer(&tick.handle);
+	sl_sleeptimer_stop_timer(&slow.handle);
+	return CHECK_Done(TEST_NAME);
+}
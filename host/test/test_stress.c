@@ -0,0 +1,231 @@
+/*
+ * test_stress.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sl_sleeptimer.h"
+#include "sl_sleeptimer_hal_sim.h"
+#include "sim.h"
+#include "check.h"
+
+// Starts, stops and restarts one-shot and periodic timers of priorities 0 to
+// 3 at random on the simulated RTC, from just before the counter wraps and
+// across many overflows of the 24-bit RTC, with the interrupt running a few
+// ticks late. Every expiry is checked against its due count: never early,
+// never later than the interrupt latency and the compare margin allow. Also
+// reports the host time the interrupt takes per expiry. Built against both
+// timer stores, test_stress_wheel for the timing wheel.
+
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+#define TEST_NAME       "stress wheel"
+#else
+#define TEST_NAME       "stress"
+#endif
+
+#define TIMERS          32
+#define OPERATIONS      500000
+#define STEP_MAX        4096u
+#define PERIOD_MIN      256u
+#define LATENCY         3u
+// the HAL never sets the compare closer than 2 ticks ahead
+#define LATE_MAX        (LATENCY + 2u)
+#define START_COUNT     0xFFFF0000u
+#define RTC_MASK        0x00FFFFFFu
+// expiries this close to an RTC overflow count as around it
+#define OVERFLOW_WINDOW 64u
+// more expiries than this in one advance means the interrupt never returns
+#define EXPIRIES_LIMIT  100000u
+
+typedef struct Timer {
+	sl_sleeptimer_timer_handle_t handle;
+	bool running;
+	bool missed;
+	uint32_t due;
+	uint32_t period;
+} Timer;
+
+static Timer timers[TIMERS];
+static uint32_t expiries;
+static uint32_t advance_expiries;
+static uint32_t late_max;
+static uint32_t early;
+static uint32_t missed;
+static uint32_t missed_overflow;
+static uint32_t overflow_expiries;
+
+static uint32_t xorshift(uint32_t *state) {
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return *state = x;
+}
+
+static bool near_overflow(uint32_t count) {
+	uint32_t low = count & RTC_MASK;
+
+	return low < OVERFLOW_WINDOW || low > RTC_MASK - OVERFLOW_WINDOW;
+}
+
+static void count_missed(Timer *timer) {
+	missed++;
+	if (near_overflow(timer->due)) {
+		missed_overflow++;
+	}
+}
+
+static void expired(sl_sleeptimer_timer_handle_t *handle, void *data) {
+	Timer *timer = data;
+	int32_t late = (int32_t) (sl_sleeptimer_get_tick_count() - timer->due);
+
+	(void) handle;
+	if (++advance_expiries > EXPIRIES_LIMIT) {
+		fprintf(stderr, "interrupt did not return after %u expiries\n",
+				EXPIRIES_LIMIT);
+		exit(1);
+	}
+	expiries++;
+	if (near_overflow(timer->due)) {
+		overflow_expiries++;
+	}
+	if (late < 0) {
+		early++;
+	} else if ((uint32_t) late > late_max) {
+		late_max = late;
+	}
+	if (late > (int32_t) LATE_MAX && !timer->missed) {
+		count_missed(timer);
+	}
+	timer->missed = false;
+
+	if (timer->period != 0) {
+		timer->due += timer->period;
+	} else {
+		timer->running = false;
+	}
+}
+
+// mostly short timeouts, some across one or two RTC overflows, some due
+// right around the next one
+static uint32_t random_timeout(uint32_t *seed) {
+	uint32_t r = xorshift(seed);
+	uint32_t now = sl_sleeptimer_get_tick_count();
+	uint32_t to_overflow = (RTC_MASK - (now & RTC_MASK)) + 1;
+	uint32_t around = to_overflow - OVERFLOW_WINDOW
+			+ (r >> 3) % (2 * OVERFLOW_WINDOW);
+
+	switch (r & 7) {
+	case 0:
+	case 1:
+		return 1 + (r >> 3) % 16;
+	case 6:
+		return 1 + (r >> 3) % (2 * (RTC_MASK + 1));
+	case 7:
+		return (around > to_overflow + OVERFLOW_WINDOW) ? 1 : around;
+	default:
+		return 1 + (r >> 3) % 65536;
+	}
+}
+
+static void start(Timer *timer, uint32_t *seed, bool restart) {
+	uint32_t timeout = random_timeout(seed);
+	uint8_t priority = xorshift(seed) & 3;
+	bool periodic = (xorshift(seed) & 1) != 0;
+
+	// keeps periodic timers from flooding the run
+	if (periodic && timeout < PERIOD_MIN) {
+		timeout += PERIOD_MIN;
+	}
+	timer->period = periodic ? timeout : 0;
+	timer->due = sl_sleeptimer_get_tick_count() + timeout;
+	timer->running = true;
+	timer->missed = false;
+	if (periodic) {
+		if (restart) {
+			sl_sleeptimer_restart_periodic_timer(&timer->handle, timeout,
+					expired, timer, priority, 0);
+		} else {
+			sl_sleeptimer_start_periodic_timer(&timer->handle, timeout, expired,
+					timer, priority, 0);
+		}
+	} else if (restart) {
+		sl_sleeptimer_restart_timer(&timer->handle, timeout, expired, timer,
+				priority, 0);
+	} else {
+		sl_sleeptimer_start_timer(&timer->handle, timeout, expired, timer,
+				priority, 0);
+	}
+}
+
+int main(void) {
+	uint32_t seed = 0xC0FFEE;
+	uint64_t irq_ns = 0;
+	double irq_ns_max = 0;
+
+	sl_sleeptimer_init();
+	sl_sleeptimer_hal_sim_set_counter(START_COUNT);
+	sl_sleeptimer_hal_sim_set_latency(LATENCY);
+
+	for (uint32_t op = 0; op < OPERATIONS; op++) {
+		Timer *timer = &timers[xorshift(&seed) % TIMERS];
+		uint32_t action = xorshift(&seed) % 4;
+		uint64_t start_ns;
+		uint64_t ns;
+
+		if (!timer->running) {
+			start(timer, &seed, false);
+		} else if (action == 0) {
+			sl_sleeptimer_stop_timer(&timer->handle);
+			timer->running = false;
+		} else if (action == 1) {
+			start(timer, &seed, true);
+		}
+
+		advance_expiries = 0;
+		start_ns = SIM_NowNs();
+		sl_sleeptimer_hal_sim_advance(1 + xorshift(&seed) % STEP_MAX);
+		ns = SIM_NowNs() - start_ns;
+		if (advance_expiries > 0) {
+			irq_ns += ns;
+			if ((double) ns / advance_expiries > irq_ns_max) {
+				irq_ns_max = (double) ns / advance_expiries;
+			}
+		}
+
+		// timers that should have run by now
+		for (uint32_t i = 0; i < TIMERS; i++) {
+			if (timers[i].running && !timers[i].missed
+					&& (int32_t) (sl_sleeptimer_get_tick_count() - timers[i].due)
+							> (int32_t) LATE_MAX) {
+				timers[i].missed = true;
+				count_missed(&timers[i]);
+			}
+		}
+	}
+
+	printf("%u expiries, %u around an RTC overflow, %u RTC overflows\n",
+			expiries, overflow_expiries,
+			(sl_sleeptimer_get_tick_count() - START_COUNT) >> 24);
+	printf("late max %u ticks, %u early, %u missed (%u around an overflow)\n",
+			late_max, early, missed, missed_overflow);
+	printf("interrupt %.0f ns per expiry, worst %.0f\n",
+			expiries ? (double) irq_ns / expiries : 0.0, irq_ns_max);
+
+	CHECK(expiries > OPERATIONS / 2, "%u expiries", expiries);
+	CHECK(early == 0, "%u early", early);
+	CHECK(missed == 0, "%u missed", missed);
+	CHECK(late_max <= LATE_MAX, "late by %u", late_max);
+	for (uint32_t i = 0; i < TIMERS; i++) {
+		if (timers[i].running) {
+			sl_sleeptimer_stop_timer(&timers[i].handle);
+		}
+	}
+	return CHECK_Done(TEST_NAME);
+}
@@ -0,0 +1,208 @@
+/*
+ * verify_time.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "clock_control.h"
+#include "sim.h"
+
+// Converts every second of the 32-bit counter, or the range given as
+// arguments, with GetCurrTime and with a faster variant, and checks both
+// against gmtime_r. The range is split into chunks the threads take from a
+// shared counter. Prints the conversions per second of each and the number of
+// mismatches; exits non-zero on any.
+//
+//   verify_time [first [last]]
+
+#define CHUNK_SECONDS (1u << 20)
+#define THREADS_MAX   64
+#define PRINT_MAX     5
+
+typedef Time (*ConvertFn)(uint32_t sec);
+
+typedef struct Converter {
+	const char *name;
+	ConvertFn convert;
+	uint64_t mismatches;
+} Converter;
+
+static uint64_t first_second;
+static uint64_t last_second;
+static uint64_t chunks;
+static uint64_t next_chunk;
+
+/***************************************************************************//**
+ * @brief GetCurrTime with the date part of Neri and Schneider, "Euclidean
+ *        affine functions and their application to calendar algorithms"
+ *        (2022): the year and month come from multiplications and shifts.
+ * @note  The year step takes the upper half of a 32x32 bit product, which the
+ *        M0+ has no instruction for, so this stays a host reference.
+ ******************************************************************************/
+static Time fast_time(uint32_t sec) {
+	// 82 eras of 400 years keep the day count positive and in 32 bits
+	const uint32_t shift = 82;
+	uint32_t days = sec / 86400;
+	uint32_t rem = sec - days * 86400;
+	uint32_t hour = rem / 3600;
+	uint32_t min = (rem - hour * 3600) / 60;
+
+	uint32_t n = days + 719468 + 146097 * shift;
+	uint32_t n1 = 4 * n + 3;
+	uint32_t century = n1 / 146097;
+	uint32_t n2 = (n1 % 146097) | 3;
+	uint64_t p2 = (uint64_t) 2939745 * n2;
+	uint32_t year_of_century = (uint32_t) (p2 >> 32);
+	uint32_t doy = (uint32_t) p2 / 2939745 / 4;                      // from March
+	uint32_t n3 = 2141 * doy + 197913;
+	uint32_t month = n3 >> 16;
+	uint32_t mday = (n3 & 0xFFFF) / 2141 + 1;
+	uint32_t january = doy >= 306;
+
+	Time t = { rem - hour * 3600 - min * 60, min, hour, mday,
+			january ? month - 12 : month, (int32_t) (100 * century
+					+ year_of_century - 400 * shift + january), (int32_t) ((days
+					+ THU) % 7) };
+	return t;
+}
+
+static Converter converters[] = { { "GetCurrTime", GetCurrTime, 0 }, {
+		"Neri-Schneider", fast_time, 0 } };
+#define CONVERTERS (sizeof(converters) / sizeof(converters[0]))
+
+// tm_wday counts from Sunday, Time.tm_wday from Monday
+static bool same_as_tm(const Time *t, const struct tm *tm) {
+	return t->tm_sec == (uint32_t) tm->tm_sec && t->tm_min == (uint32_t) tm->tm_min
+			&& t->tm_hour == (uint32_t) tm->tm_hour
+			&& t->tm_mday == (uint32_t) tm->tm_mday
+			&& t->tm_mon == (uint32_t) tm->tm_mon + 1
+			&& t->tm_year == tm->tm_year + 1900
+			&& t->tm_wday == (tm->tm_wday + 6) % 7;
+}
+
+static bool take_chunk(uint64_t *begin, uint64_t *end) {
+	uint64_t chunk = __atomic_fetch_add(&next_chunk, 1, __ATOMIC_RELAXED);
+
+	if (chunk >= chunks) {
+		return false;
+	}
+	*begin = first_second + chunk * CHUNK_SECONDS;
+	*end = *begin + CHUNK_SECONDS - 1;
+	if (*end > last_second) {
+		*end = last_second;
+	}
+	return true;
+}
+
+static void *time_worker(void *arg) {
+	ConvertFn convert = ((Converter *) arg)->convert;
+	uint64_t begin;
+	uint64_t end;
+	uint32_t sink = 0;
+
+	while (take_chunk(&begin, &end)) {
+		for (uint64_t sec = begin; sec <= end; sec++) {
+			Time t = convert((uint32_t) sec);
+
+			sink += t.tm_sec + t.tm_mday + t.tm_year + t.tm_wday;
+		}
+	}
+	return (void *) (uintptr_t) sink;
+}
+
+static void *check_worker(void *arg) {
+	uint64_t begin;
+	uint64_t end;
+	uint64_t mismatches[CONVERTERS] = { 0 };
+
+	(void) arg;
+	while (take_chunk(&begin, &end)) {
+		for (uint64_t sec = begin; sec <= end; sec++) {
+			time_t tt = (time_t) sec;
+			struct tm tm;
+
+			gmtime_r(&tt, &tm);
+			for (uint32_t c = 0; c < CONVERTERS; c++) {
+				Time t = converters[c].convert((uint32_t) sec);
+
+				if (!same_as_tm(&t, &tm)
+						&& mismatches[c]++ < PRINT_MAX) {
+					fprintf(stderr, "%s(%lu): %04d-%02u-%02u %02u:%02u:%02u "
+							"wday %d\n", converters[c].name,
+							(unsigned long) sec, t.tm_year, t.tm_mon,
+							t.tm_mday, t.tm_hour, t.tm_min, t.tm_sec,
+							t.tm_wday);
+				}
+			}
+		}
+	}
+	for (uint32_t c = 0; c < CONVERTERS; c++) {
+		__atomic_fetch_add(&converters[c].mismatches, mismatches[c],
+				__ATOMIC_RELAXED);
+	}
+	return NULL;
+}
+
+/***************************************************************************//**
+ * @brief Runs worker on every thread until the chunks run out.
+ * @return Wall time in nanoseconds.
+ ******************************************************************************/
+static uint64_t run(void *(*worker)(void *), void *arg, uint32_t threads) {
+	pthread_t ids[THREADS_MAX];
+	uint64_t start = SIM_NowNs();
+
+	next_chunk = 0;
+	for (uint32_t i = 0; i < threads; i++) {
+		pthread_create(&ids[i], NULL, worker, arg);
+	}
+	for (uint32_t i = 0; i < threads; i++) {
+		pthread_join(ids[i], NULL);
+	}
+	return SIM_NowNs() - start;
+}
+
+int main(int argc, char **argv) {
+	long online = sysconf(_SC_NPROCESSORS_ONLN);
+	uint32_t threads = (online < 1) ? 1 :
+						(online > THREADS_MAX) ? THREADS_MAX : (uint32_t) online;
+	uint64_t seconds;
+	uint64_t ns;
+	bool failed = false;
+
+	// the check takes minutes, show each result as it comes
+	setvbuf(stdout, NULL, _IOLBF, 0);
+	first_second = (argc > 1) ? strtoull(argv[1], NULL, 0) : 0;
+	last_second = (argc > 2) ? strtoull(argv[2], NULL, 0) : UINT32_MAX;
+	if (last_second > UINT32_MAX || first_second > last_second) {
+		fprintf(stderr, "usage: %s [first [last]], within 0..%u\n", argv[0],
+				UINT32_MAX);
+		return 2;
+	}
+	seconds = last_second - first_second + 1;
+	chunks = (seconds + CHUNK_SECONDS - 1) / CHUNK_SECONDS;
+	printf("seconds %lu..%lu on %u threads\n", (unsigned long) first_second,
+			(unsigned long) last_second, threads);
+
+	for (uint32_t c = 0; c < CONVERTERS; c++) {
+		ns = run(time_worker, &converters[c], threads);
+		printf("%-16s %14.0f conv/s\n", converters[c].name,
+				seconds * 1e9 / ns);
+	}
+
+	ns = run(check_worker, NULL, threads);
+	printf("checked against gmtime_r in %.1f s\n", ns / 1e9);
+	for (uint32_t c = 0; c < CONVERTERS; c++) {
+		printf("%-16s %14lu mismatches\n", converters[c].name,
+				(unsigned long) converters[c].mismatches);
+		failed |= converters[c].mismatches != 0;
+	}
+	return failed;
+}
@@ -31,17 +31,17 @@ extern "C" {
  *****************************   PROTOTYPES   **********************************
  ******************************************************************************/
 void GRAPHICS_Init(void);
-void GRAPHICS_Draw_Clock(int32_t tempData, uint32_t rhData, uint32_t sec, bool alarm,
-		bool ring, bool lowBat);
+void GRAPHICS_Draw_Clock(int32_t tempData, uint32_t rhData, const Time *t,
+		bool alarm, bool ring, bool lowBat);
 void GRAPHICS_ShowStatus(bool si7013_status, bool lowBat);
 void GRAPHICS_Draw_Weather_Station(int32_t tempData, int32_t rhData,
 		bool lowBat, int32_t temp_min_mC, int32_t temp_max_mC,
 		int32_t humidity_min, int32_t humidity_max, bool weather_reset);
 void GRAPHICS_DrawMenu(int32_t selectedPage, bool lowBat);
-void GRPAHICS_DrawTimeAdj(int32_t pos_h, uint32_t time, int32_t offset,
+void GRPAHICS_DrawTimeAdj(int32_t pos_h, const Time *t, bool blink,
+		bool lowBat);
+void GRAPHICS_DrawAlarmSet(uint32_t slot, const Alarm *alarm, int8_t sel,
 		bool blink, bool lowBat);
-void GRAPHICS_DrawAlarmSet(uint32_t alarmTime, AlarmType type, Day day,
-		int8_t sel, bool blink, bool lowBat);
 
 #ifdef __cplusplus
 }
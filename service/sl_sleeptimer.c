@@ -35,6 +35,9 @@
 #include "em_core.h"
 #include "sl_sleeptimer.h"
 #include "sl_sleeptimer_hal.h"
+#include "sl_sleeptimer_slack.h"
+#include "sl_sleeptimer_deferred.h"
+#include "sl_sleeptimer_wallclock64.h"
 
 #define TIME_UNIX_EPOCH                         (1970u)
 #define TIME_NTP_EPOCH                          (1900u)
@@ -52,6 +55,23 @@
 #define TIME_UNIX_YEAR_MAX                      (2038u - TIME_NTP_EPOCH)                                 ///< Max UNIX year based from a 1900 epoch
 
 #define TIME_LEAP_DAYS_UP_TO_YEAR(year)         (((year - 3) / 4) + 1)
+#define TIME_MS_PER_DAY                         (TIME_SEC_PER_DAY * 1000u)
+#define TIME_DAY_PER_ERA                        (146097u)                                                ///< 400 years
+#define TIME_DAY_COUNT_MARCH_0_TO_UNIX_EPOCH    (719468u)                                                ///< Days from March 1, year 0
+
+// Set to 1 to keep timers in a hierarchical timing wheel instead of the delta
+// list. Insert and cancel no longer walk every running timer, at the cost of
+// WHEEL_LEVELS * WHEEL_SLOTS list heads of RAM.
+#ifndef SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+#define SL_SLEEPTIMER_TIMER_WHEEL_CONFIG        0
+#endif
+
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+#define WHEEL_SLOT_BITS                         (4u)
+#define WHEEL_SLOTS                             (1u << WHEEL_SLOT_BITS)
+#define WHEEL_SLOT_MASK                         (WHEEL_SLOTS - 1u)
+#define WHEEL_LEVELS                            (32u / WHEEL_SLOT_BITS)
+#endif
 
 /// @brief Time Format.
 SLEEPTIMER_ENUM(sl_sleeptimer_time_format_t) {
@@ -77,27 +97,91 @@ static sl_sleeptimer_time_zone_offset_t tz_offset = 0;
 static uint32_t calculated_tick_rest = 0;
 // Precalculated timer overflow duration in seconds.
 static uint32_t calculated_sec_count = 0;
+// 64 bits wallclock in milliseconds at tick count 0.
+static uint64_t ms64_epoch = 0;
 #endif
 
 // Timer frequency in Hz.
 static uint32_t timer_frequency;
 
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+// Timing wheel. A timer sits at the level of the most significant digit in
+// which its expiry count (kept in handle->delta) differs from wheel_time, in
+// the slot given by that digit of the expiry. All timers of a level expire
+// before any timer of a higher level.
+static sl_sleeptimer_timer_handle_t *wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+// Timers that expire after the counter wraps around.
+static sl_sleeptimer_timer_handle_t *wheel_wrapped;
+// Bit n set when slot n of a level is not empty.
+static uint16_t wheel_occupied[WHEEL_LEVELS];
+// Count the wheel has been advanced to, never past the first expiry.
+static sl_sleeptimer_tick_count_t wheel_time;
+static uint32_t wheel_count;
+#else
 // Head of timer list.
 static sl_sleeptimer_timer_handle_t *timer_head;
+#endif
 
 // Count at last update of delta of first timer.
 static sl_sleeptimer_tick_count_t last_delta_update_count;
 
+// Timers allowed to expire late, by how many ticks.
+static struct {
+  sl_sleeptimer_timer_handle_t *handle;
+  uint32_t slack;
+} timer_slack[SL_SLEEPTIMER_SLACK_TIMERS_MAX];
+
+// Expiries folded into the wakeup the comparator is set for.
+static uint32_t pending_wakeups_avoided;
+// Expiries served by the wakeup of an earlier timer.
+static uint32_t wakeups_avoided;
+
+// The uint8_t indices wrap at 256 and pick their slot with %, so the size must
+// divide 256, and stay below it for head - tail to tell a full queue from an
+// empty one.
+#if (SL_SLEEPTIMER_DEFERRED_QUEUE_SIZE == 0) \
+  || ((SL_SLEEPTIMER_DEFERRED_QUEUE_SIZE & (SL_SLEEPTIMER_DEFERRED_QUEUE_SIZE - 1)) != 0) \
+  || (SL_SLEEPTIMER_DEFERRED_QUEUE_SIZE > 128)
+#error "SL_SLEEPTIMER_DEFERRED_QUEUE_SIZE must be a power of two, at most 128"
+#endif
+
+// Callbacks waiting for sl_sleeptimer_run_deferred_callbacks(). Single
+// producer (the timer interrupt), single consumer, so no lock is needed: each
+// side only writes its own index.
+static struct {
+  sl_sleeptimer_timer_handle_t *handle;
+  sl_sleeptimer_timer_callback_t callback;
+  void *callback_data;
+} deferred_queue[SL_SLEEPTIMER_DEFERRED_QUEUE_SIZE];
+static volatile uint8_t deferred_head;
+static volatile uint8_t deferred_tail;
+
+// Timer interrupt statistics.
+static sl_sleeptimer_deferred_stats_t deferred_stats;
+
 // Initialization flag.
 static bool is_sleeptimer_initialized = false;
 
 // Precalculated value to avoid millisecond to tick conversion overflow.
 static uint32_t max_millisecond_conversion;
 
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+static void wheel_insert_timer(sl_sleeptimer_timer_handle_t *handle,
+                               sl_sleeptimer_tick_count_t expiry);
+
+static sl_status_t wheel_remove_timer(sl_sleeptimer_timer_handle_t *handle);
+
+static bool wheel_has_timer(sl_sleeptimer_timer_handle_t *handle);
+
+static sl_sleeptimer_timer_handle_t *wheel_next_timer(void);
+
+static void wheel_advance(sl_sleeptimer_tick_count_t count);
+#else
 static void delta_list_insert_timer(sl_sleeptimer_timer_handle_t *handle,
                                     sl_sleeptimer_tick_count_t timeout);
 
 static sl_status_t delta_list_remove_timer(sl_sleeptimer_timer_handle_t *handle);
+#endif
 
 static void set_comparator_for_next_timer(void);
 
@@ -110,14 +194,22 @@ __STATIC_INLINE bool is_power_of_2(uint32_t nbr);
 static sl_status_t create_timer(sl_sleeptimer_timer_handle_t *handle,
                                 sl_sleeptimer_tick_count_t timeout_initial,
                                 sl_sleeptimer_tick_count_t timeout_periodic,
+                                sl_sleeptimer_tick_count_t slack,
                                 sl_sleeptimer_timer_callback_t callback,
                                 void *callback_data,
                                 uint8_t priority,
                                 uint16_t option_flags);
 
+static sl_status_t set_timer_slack(sl_sleeptimer_timer_handle_t *handle,
+                                   sl_sleeptimer_tick_count_t slack);
+
+static sl_sleeptimer_tick_count_t get_timer_slack(sl_sleeptimer_timer_handle_t *handle);
+
 static void delay_callback(sl_sleeptimer_timer_handle_t *handle,
                            void *data);
 
+static void run_timer_callback(sl_sleeptimer_timer_handle_t *handle);
+
 #if SL_SLEEPTIMER_WALLCLOCK_CONFIG
 static bool is_leap_year(uint16_t year);
 
@@ -130,6 +222,10 @@ static bool is_valid_time(sl_sleeptimer_timestamp_t time,
 
 static bool is_valid_date(sl_sleeptimer_date_t *date);
 
+static bool is_valid_date_ms64(sl_sleeptimer_date_t *date);
+
+static uint64_t get_tick_ms64(void);
+
 static const uint8_t days_in_month[2u][12] = {
   /* Jan  Feb  Mar  Apr  May  Jun  Jul  Aug  Sep  Oct  Nov  Dec */
   { 31u, 28u, 31u, 30u, 31u, 30u, 31u, 31u, 30u, 31u, 30u, 31u },
@@ -146,8 +242,28 @@ sl_status_t sl_sleeptimer_init(void)
 
   CORE_ENTER_ATOMIC();
   if (!is_sleeptimer_initialized) {
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+    for (uint32_t level = 0u; level < WHEEL_LEVELS; level++) {
+      for (uint32_t slot = 0u; slot < WHEEL_SLOTS; slot++) {
+        wheel[level][slot] = NULL;
+      }
+      wheel_occupied[level] = 0u;
+    }
+    wheel_wrapped = NULL;
+    wheel_time = 0u;
+    wheel_count = 0u;
+#else
     timer_head  = NULL;
+#endif
     last_delta_update_count = 0u;
+    for (uint32_t i = 0u; i < SL_SLEEPTIMER_SLACK_TIMERS_MAX; i++) {
+      timer_slack[i].handle = NULL;
+    }
+    pending_wakeups_avoided = 0u;
+    wakeups_avoided = 0u;
+    deferred_head = 0u;
+    deferred_tail = 0u;
+    deferred_stats = (sl_sleeptimer_deferred_stats_t){ 0 };
     overflow_counter = 0u;
     sleeptimer_hal_init_timer();
     sleeptimer_hal_enable_int(SLEEPTIMER_EVENT_OF);
@@ -155,6 +271,7 @@ sl_status_t sl_sleeptimer_init(void)
 
 #if SL_SLEEPTIMER_WALLCLOCK_CONFIG
     second_count = 0;
+    ms64_epoch = 0;
     calculated_tick_rest = ((uint64_t)UINT32_MAX + 1) % (uint64_t)timer_frequency;
     calculated_sec_count = (((uint64_t)UINT32_MAX + 1) / (uint64_t)timer_frequency);
 #endif
@@ -190,6 +307,7 @@ sl_status_t sl_sleeptimer_start_timer(sl_sleeptimer_timer_handle_t *handle,
   return create_timer(handle,
                       timeout,
                       0,
+                      0,
                       callback,
                       callback_data,
                       priority,
@@ -217,6 +335,7 @@ sl_status_t sl_sleeptimer_restart_timer(sl_sleeptimer_timer_handle_t *handle,
   return create_timer(handle,
                       timeout,
                       0,
+                      0,
                       callback,
                       callback_data,
                       priority,
@@ -247,6 +366,7 @@ sl_status_t sl_sleeptimer_start_periodic_timer(sl_sleeptimer_timer_handle_t *han
   return create_timer(handle,
                       timeout,
                       timeout,
+                      0,
                       callback,
                       callback_data,
                       priority,
@@ -274,12 +394,146 @@ sl_status_t sl_sleeptimer_restart_periodic_timer(sl_sleeptimer_timer_handle_t *h
   return create_timer(handle,
                       timeout,
                       timeout,
+                      0,
                       callback,
                       callback_data,
                       priority,
                       option_flags);
 }
 
+/**************************************************************************//**
+ * Starts a 32 bits timer that may expire late.
+ *****************************************************************************/
+sl_status_t sl_sleeptimer_start_timer_slack(sl_sleeptimer_timer_handle_t *handle,
+                                            uint32_t timeout,
+                                            uint32_t slack,
+                                            sl_sleeptimer_timer_callback_t callback,
+                                            void *callback_data,
+                                            uint8_t priority,
+                                            uint16_t option_flags)
+{
+  bool is_running = false;
+
+  if (handle == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  sl_sleeptimer_is_timer_running(handle, &is_running);
+  if (is_running == true) {
+    return SL_STATUS_NOT_READY;
+  }
+
+  return create_timer(handle,
+                      timeout,
+                      0,
+                      slack,
+                      callback,
+                      callback_data,
+                      priority,
+                      option_flags);
+}
+
+/**************************************************************************//**
+ * Starts a 32 bits periodic timer that may expire late.
+ *****************************************************************************/
+sl_status_t sl_sleeptimer_start_periodic_timer_slack(sl_sleeptimer_timer_handle_t *handle,
+                                                     uint32_t timeout,
+                                                     uint32_t slack,
+                                                     sl_sleeptimer_timer_callback_t callback,
+                                                     void *callback_data,
+                                                     uint8_t priority,
+                                                     uint16_t option_flags)
+{
+  bool is_running = false;
+
+  if (handle == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  sl_sleeptimer_is_timer_running(handle, &is_running);
+  if (is_running == true) {
+    return SL_STATUS_INVALID_STATE;
+  }
+
+  return create_timer(handle,
+                      timeout,
+                      timeout,
+                      slack,
+                      callback,
+                      callback_data,
+                      priority,
+                      option_flags);
+}
+
+/**************************************************************************//**
+ * Gets the number of wakeups saved by timer slack.
+ *****************************************************************************/
+uint32_t sl_sleeptimer_get_wakeups_avoided(void)
+{
+  return wakeups_avoided;
+}
+
+/***************************************************************************//**
+ * Runs the deferred timer callbacks.
+ ******************************************************************************/
+uint32_t sl_sleeptimer_run_deferred_callbacks(void)
+{
+  uint32_t count = 0u;
+  uint8_t tail = deferred_tail;
+
+  while (tail != deferred_head) {
+    sl_sleeptimer_timer_handle_t *handle;
+    sl_sleeptimer_timer_callback_t callback;
+    void *callback_data;
+
+    // Read the entry before handing its slot back to the interrupt.
+    __DMB();
+    handle = deferred_queue[tail % SL_SLEEPTIMER_DEFERRED_QUEUE_SIZE].handle;
+    callback = deferred_queue[tail % SL_SLEEPTIMER_DEFERRED_QUEUE_SIZE].callback;
+    callback_data = deferred_queue[tail % SL_SLEEPTIMER_DEFERRED_QUEUE_SIZE].callback_data;
+    __DMB();
+    tail++;
+    deferred_tail = tail;
+
+    callback(handle, callback_data);
+    count++;
+  }
+
+  return count;
+}
+
+/***************************************************************************//**
+ * Checks if deferred callbacks are waiting.
+ ******************************************************************************/
+bool sl_sleeptimer_has_deferred_callbacks(void)
+{
+  return deferred_tail != deferred_head;
+}
+
+/***************************************************************************//**
+ * Gets the timer interrupt statistics.
+ ******************************************************************************/
+void sl_sleeptimer_get_deferred_stats(sl_sleeptimer_deferred_stats_t *stats)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  *stats = deferred_stats;
+  CORE_EXIT_ATOMIC();
+}
+
+/***************************************************************************//**
+ * Clears the timer interrupt statistics.
+ ******************************************************************************/
+void sl_sleeptimer_reset_deferred_stats(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  deferred_stats = (sl_sleeptimer_deferred_stats_t){ 0 };
+  CORE_EXIT_ATOMIC();
+}
+
 /**************************************************************************//**
  * Stops a 32 bits timer.
  *****************************************************************************/
@@ -287,8 +541,6 @@ sl_status_t sl_sleeptimer_stop_timer(sl_sleeptimer_timer_handle_t *handle)
 {
   CORE_DECLARE_IRQ_STATE;
   sl_status_t error;
-  bool set_comparator = false;
-
   if (handle == NULL) {
     return SL_STATUS_NULL_POINTER;
   }
@@ -296,22 +548,35 @@ sl_status_t sl_sleeptimer_stop_timer(sl_sleeptimer_timer_handle_t *handle)
   CORE_ENTER_ATOMIC();
   update_first_timer_delta();
 
-  // If first timer in list, update timer comparator.
-  if (timer_head == handle) {
-    set_comparator = true;
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+  error = wheel_remove_timer(handle);
+  if (error != SL_STATUS_OK) {
+    CORE_EXIT_ATOMIC();
+    return error;
   }
 
+  // The timer may have been folded into the next wakeup, so the comparator
+  // is updated even if it was not the first one.
+  if (wheel_count > 0u) {
+    set_comparator_for_next_timer();
+  } else {
+    sleeptimer_hal_disable_int(SLEEPTIMER_EVENT_COMP);
+  }
+#else
   error = delta_list_remove_timer(handle);
   if (error != SL_STATUS_OK) {
     CORE_EXIT_ATOMIC();
     return error;
   }
 
-  if (set_comparator && timer_head) {
+  // The timer may have been folded into the next wakeup, so the comparator
+  // is updated even if it was not the first one.
+  if (timer_head) {
     set_comparator_for_next_timer();
-  } else if (!timer_head) {
+  } else {
     sleeptimer_hal_disable_int(SLEEPTIMER_EVENT_COMP);
   }
+#endif
 
   CORE_EXIT_ATOMIC();
   return SL_STATUS_OK;
@@ -324,13 +589,18 @@ sl_status_t sl_sleeptimer_is_timer_running(sl_sleeptimer_timer_handle_t *handle,
                                            bool *running)
 {
   CORE_DECLARE_IRQ_STATE;
+#if !SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
   sl_sleeptimer_timer_handle_t *current;
+#endif
 
   if (handle == NULL || running == NULL) {
     return SL_STATUS_NULL_POINTER;
   } else {
     *running = false;
     CORE_ENTER_ATOMIC();
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+    *running = wheel_has_timer(handle);
+#else
     current = timer_head;
     while (current != NULL && !*running) {
       if (current == handle) {
@@ -339,6 +609,7 @@ sl_status_t sl_sleeptimer_is_timer_running(sl_sleeptimer_timer_handle_t *handle,
         current = current->next;
       }
     }
+#endif
     CORE_EXIT_ATOMIC();
   }
   return SL_STATUS_OK;
@@ -351,7 +622,11 @@ sl_status_t sl_sleeptimer_get_timer_time_remaining(sl_sleeptimer_timer_handle_t
                                                    uint32_t *time)
 {
   CORE_DECLARE_IRQ_STATE;
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+  sl_sleeptimer_tick_count_t elapsed;
+#else
   sl_sleeptimer_timer_handle_t *current;
+#endif
 
   if (handle == NULL || time == NULL) {
     return SL_STATUS_NULL_POINTER;
@@ -360,6 +635,22 @@ sl_status_t sl_sleeptimer_get_timer_time_remaining(sl_sleeptimer_timer_handle_t
   CORE_ENTER_ATOMIC();
 
   update_first_timer_delta();
+
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+  if (!wheel_has_timer(handle)) {
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_NOT_READY;
+  }
+
+  // Expiry and current count, both relative to the wheel.
+  *time = handle->delta - wheel_time;
+  elapsed = sleeptimer_hal_get_counter() - wheel_time;
+  if (*time > elapsed) {
+    *time -= elapsed;
+  } else {
+    *time = 0;
+  }
+#else
   *time  = handle->delta;
 
   // Retrieve timer in list and add the deltas.
@@ -380,6 +671,7 @@ sl_status_t sl_sleeptimer_get_timer_time_remaining(sl_sleeptimer_timer_handle_t
   } else {
     *time = 0;
   }
+#endif
 
   CORE_EXIT_ATOMIC();
 
@@ -398,6 +690,31 @@ sl_status_t sl_sleeptimer_get_remaining_time_of_first_timer(uint16_t option_flag
   uint32_t time = 0;
 
   CORE_ENTER_ATOMIC();
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+  // The wheel is not ordered within a slot, look at every timer.
+  bool found = false;
+  time = UINT32_MAX;
+  for (uint32_t list = 0u; list <= WHEEL_LEVELS * WHEEL_SLOTS; list++) {
+    current = (list < WHEEL_LEVELS * WHEEL_SLOTS)
+              ? wheel[list / WHEEL_SLOTS][list % WHEEL_SLOTS]
+              : wheel_wrapped;
+    while (current != NULL) {
+      if (current->option_flags == option_flags
+          && current->delta - wheel_time <= time) {
+        time = current->delta - wheel_time;
+        found = true;
+      }
+      current = current->next;
+    }
+  }
+  CORE_EXIT_ATOMIC();
+
+  if (found) {
+    *time_remaining = time;
+    return SL_STATUS_OK;
+  }
+  return SL_STATUS_EMPTY;
+#else
   // parse list and retrieve first timer with HF requirement.
   current = timer_head;
   while (current != NULL) {
@@ -414,6 +731,7 @@ sl_status_t sl_sleeptimer_get_remaining_time_of_first_timer(uint16_t option_flag
   CORE_EXIT_ATOMIC();
 
   return SL_STATUS_EMPTY;
+#endif
 }
 
 /***************************************************************************//**
@@ -513,6 +831,7 @@ sl_status_t sl_sleeptimer_set_time(sl_sleeptimer_timestamp_t time)
     CORE_EXIT_ATOMIC();
     return SL_STATUS_INVALID_PARAMETER;
   }
+  ms64_epoch = (uint64_t)time * 1000u - get_tick_ms64();
 
   CORE_EXIT_ATOMIC();
 
@@ -811,6 +1130,148 @@ sl_status_t sl_sleeptimer_convert_zigbee_time_to_unix(uint32_t zigbee_time,
   }
 }
 
+/***************************************************************************//**
+ * Retrieves current 64 bits time.
+ ******************************************************************************/
+uint64_t sl_sleeptimer_get_time_ms64(void)
+{
+  uint64_t time_ms;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  time_ms = ms64_epoch + get_tick_ms64();
+  CORE_EXIT_ATOMIC();
+
+  return time_ms;
+}
+
+/***************************************************************************//**
+ * Sets current 64 bits time.
+ ******************************************************************************/
+sl_status_t sl_sleeptimer_set_time_ms64(uint64_t time_ms)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  if (time_ms / 1000u <= TIME_UNIX_TIMESTAMP_MAX) {
+    // Fails only for times before the current tick count, kept for 64 bits.
+    (void)sl_sleeptimer_set_time((sl_sleeptimer_timestamp_t)(time_ms / 1000u));
+  }
+
+  CORE_ENTER_ATOMIC();
+  ms64_epoch = time_ms - get_tick_ms64();
+  CORE_EXIT_ATOMIC();
+
+  return SL_STATUS_OK;
+}
+
+/*******************************************************************************
+ * Convert a 64 bits time stamp into a date structure.
+ ******************************************************************************/
+sl_status_t sl_sleeptimer_convert_time_ms64_to_date(uint64_t time_ms,
+                                                   sl_sleeptimer_time_zone_offset_t time_zone,
+                                                   sl_sleeptimer_date_t *date,
+                                                   uint16_t *millisecond)
+{
+  uint32_t days;
+  uint32_t ms_of_day;
+  uint32_t era;
+  uint32_t day_of_era;
+  uint32_t year_of_era;
+  uint32_t day_of_year;
+  uint32_t month;
+  uint32_t year;
+
+  if (date == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  // Local time.
+  if (time_zone < 0 && time_ms < (uint64_t)(-(int64_t)time_zone) * 1000u) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  time_ms += (int64_t)time_zone * 1000;
+
+  if (time_ms / TIME_MS_PER_DAY > UINT32_MAX - TIME_DAY_COUNT_MARCH_0_TO_UNIX_EPOCH) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  days = (uint32_t)(time_ms / TIME_MS_PER_DAY); // Only 64 bits division.
+  ms_of_day = (uint32_t)(time_ms - (uint64_t)days * TIME_MS_PER_DAY);
+
+  if (millisecond != NULL) {
+    *millisecond = ms_of_day % 1000u;
+  }
+  ms_of_day /= 1000u;
+  date->sec = ms_of_day % 60u;
+  ms_of_day /= 60u;
+  date->min = ms_of_day % 60u;
+  date->hour = ms_of_day / 60u;
+  date->day_of_week = compute_day_of_week(days);
+
+  // Years start on March 1 so the leap day is the last day of the year.
+  days += TIME_DAY_COUNT_MARCH_0_TO_UNIX_EPOCH;
+  era = days / TIME_DAY_PER_ERA;
+  day_of_era = days - era * TIME_DAY_PER_ERA;                                             // [0, 146096]
+  year_of_era = (day_of_era - day_of_era / 1460u + day_of_era / 36524u
+                 - day_of_era / (TIME_DAY_PER_ERA - 1u)) / TIME_DAY_PER_YEAR;             // [0, 399]
+  day_of_year = day_of_era - (TIME_DAY_PER_YEAR * year_of_era + year_of_era / 4u
+                              - year_of_era / 100u);                                      // [0, 365]
+  month = (5u * day_of_year + 2u) / 153u;                                                 // [0, 11] from March
+  year = era * 400u + year_of_era + (month >= 10u ? 1u : 0u);
+
+  if (year > SL_SLEEPTIMER_WALLCLOCK64_YEAR_MAX) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  date->month_day = day_of_year - (153u * month + 2u) / 5u + 1u;
+  date->month = (sl_sleeptimer_month_t)(month < 10u ? month + 2u : month - 10u);
+  date->year = year - TIME_NTP_EPOCH;
+  date->day_of_year = (month < 10u)
+                      ? day_of_year + 59u + (is_leap_year(year) ? 1u : 0u) + 1u
+                      : day_of_year - 306u + 1u;
+  date->time_zone = time_zone;
+
+  return SL_STATUS_OK;
+}
+
+/*******************************************************************************
+ * Convert a date structure into a 64 bits time stamp.
+ ******************************************************************************/
+sl_status_t sl_sleeptimer_convert_date_to_time_ms64(sl_sleeptimer_date_t *date,
+                                                   uint64_t *time_ms)
+{
+  uint32_t year;
+  uint32_t month;
+  uint32_t era;
+  uint32_t year_of_era;
+  uint32_t day_of_year;
+  uint32_t days;
+  uint64_t local_ms;
+
+  if (!is_valid_date_ms64(date) || time_ms == NULL) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  // Years start on March 1 so the leap day is the last day of the year.
+  year = date->year + TIME_NTP_EPOCH - (date->month < 2u ? 1u : 0u);
+  month = (date->month < 2u) ? date->month + 10u : date->month - 2u;                      // [0, 11] from March
+  era = year / 400u;
+  year_of_era = year - era * 400u;
+  day_of_year = (153u * month + 2u) / 5u + date->month_day - 1u;
+  days = era * TIME_DAY_PER_ERA + year_of_era * TIME_DAY_PER_YEAR + year_of_era / 4u
+         - year_of_era / 100u + day_of_year - TIME_DAY_COUNT_MARCH_0_TO_UNIX_EPOCH;
+
+  local_ms = (uint64_t)days * TIME_MS_PER_DAY
+             + ((3600u * date->hour) + (60u * date->min) + date->sec) * 1000u;
+
+  // UTC.
+  if (date->time_zone > 0 && local_ms < (uint64_t)date->time_zone * 1000u) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  *time_ms = local_ms - (int64_t)date->time_zone * 1000;
+
+  return SL_STATUS_OK;
+}
+
 #endif // SL_SLEEPTIMER_WALLCLOCK_CONFIG
 
 /*******************************************************************************
@@ -904,6 +1365,9 @@ sl_status_t sl_sleeptimer_tick64_to_ms(uint64_t tick,
 void process_timer_irq(uint8_t local_flag)
 {
   CORE_DECLARE_IRQ_STATE;
+  sl_sleeptimer_tick_count_t irq_start_cnt = sleeptimer_hal_get_counter();
+  sl_sleeptimer_tick_count_t irq_ticks;
+
   if (local_flag & SLEEPTIMER_EVENT_OF) {
 #if SL_SLEEPTIMER_WALLCLOCK_CONFIG
     uint32_t timer_freq = sl_sleeptimer_get_timer_frequency();
@@ -919,69 +1383,155 @@ void process_timer_irq(uint8_t local_flag)
 
     update_first_timer_delta();
 
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+    if (wheel_count > 0u) {
+#else
     if (timer_head) {
+#endif
       set_comparator_for_next_timer();
     }
   }
 
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
   if (local_flag & SLEEPTIMER_EVENT_COMP) {
-    sl_sleeptimer_tick_count_t delta_tot = 0u;
-    sl_sleeptimer_tick_count_t current_cnt = sleeptimer_hal_get_counter();
+    sl_sleeptimer_timer_handle_t *current;
+    sl_sleeptimer_tick_count_t current_cnt;
+
+    CORE_ENTER_ATOMIC();
+    current_cnt = sleeptimer_hal_get_counter();
+    // Process all timers that have expired, in expiry order. Timers expiring
+    // on the same count run by priority.
+    current = wheel_next_timer();
+    // The wakeup happened, count the expiries it was set to cover as well.
+    if (current != NULL
+        && current->delta - wheel_time <= current_cnt - wheel_time) {
+      wakeups_avoided += pending_wakeups_avoided;
+    }
+    pending_wakeups_avoided = 0u;
+    while (current != NULL
+           && current->delta - wheel_time <= current_cnt - wheel_time) {
+      wheel_advance(current->delta);
+      wheel_remove_timer(current);
+
+      if (current->timeout_periodic != 0u) {
+        wheel_insert_timer(current, current->delta + current->timeout_periodic);
+      }
+      CORE_EXIT_ATOMIC();
+
+      run_timer_callback(current);
 
-    delta_tot = current_cnt - last_delta_update_count;
+      CORE_ENTER_ATOMIC();
+      current_cnt = sleeptimer_hal_get_counter();
+      current = wheel_next_timer();
+    }
+
+    wheel_advance(current_cnt);
+    last_delta_update_count = current_cnt;
+    if (wheel_count > 0u) {
+      set_comparator_for_next_timer();
+    } else {
+      sleeptimer_hal_disable_int(SLEEPTIMER_EVENT_COMP);
+    }
+    CORE_EXIT_ATOMIC();
+  }
+#else
+
+  if (local_flag & SLEEPTIMER_EVENT_COMP) {
+    sl_sleeptimer_tick_count_t delta_tot;
 
     CORE_ENTER_ATOMIC();
-    // Process all timers that have expired.
+    // Ticks since the base of the list, the head delta counts from there.
+    delta_tot = sleeptimer_hal_get_counter() - last_delta_update_count;
+    // The wakeup happened, count the expiries it was set to cover as well.
+    if ((timer_head) && (delta_tot >= timer_head->delta)) {
+      wakeups_avoided += pending_wakeups_avoided;
+    }
+    pending_wakeups_avoided = 0u;
+    // Process all timers that have expired. Among them, the one with the
+    // highest priority runs first, in expiry order for equal priorities.
     while ((timer_head) && (delta_tot >= timer_head->delta)) {
-      sl_sleeptimer_tick_count_t new_cnt;
-      sl_sleeptimer_tick_count_t delta_tot_temp = delta_tot;
       sl_sleeptimer_timer_handle_t *current = timer_head;
-      sl_sleeptimer_timer_handle_t *temp = timer_head;
-
-      last_delta_update_count = current_cnt;
-
-      while ((temp != NULL) && (delta_tot_temp >= temp->delta)) {
-        if (current->priority > temp->priority) {
+      sl_sleeptimer_timer_handle_t *temp;
+      // Expiries relative to the base, of the scanned and chosen timer.
+      sl_sleeptimer_tick_count_t expiry = timer_head->delta;
+      sl_sleeptimer_tick_count_t offset = expiry;
+
+      for (temp = timer_head->next;
+           temp != NULL && temp->delta <= delta_tot - expiry;
+           temp = temp->next) {
+        expiry += temp->delta;
+        if (temp->priority < current->priority) {
           current = temp;
+          offset = expiry;
         }
-
-        delta_tot_temp -= temp->delta;
-        temp = temp->next;
       }
-      CORE_EXIT_ATOMIC();
-      delta_tot -= current->delta;
-      current->delta = 0;
 
-      CORE_ENTER_ATOMIC();
+      // The next timer takes over the delta, the base stays where it is.
       delta_list_remove_timer(current);
-      CORE_EXIT_ATOMIC();
-
       if (current->timeout_periodic != 0u) {
-        CORE_ENTER_ATOMIC();
-        delta_list_insert_timer(current, current->timeout_periodic);
-        CORE_EXIT_ATOMIC();
+        // The period counts from the expiry, not from the late run.
+        delta_list_insert_timer(current, offset + current->timeout_periodic);
       }
+      CORE_EXIT_ATOMIC();
 
-      if (current->callback != NULL) {
-        current->callback(current, current->callback_data);
-      }
+      run_timer_callback(current);
 
-      new_cnt = sleeptimer_hal_get_counter();
-      delta_tot += new_cnt - current_cnt;
-      current_cnt = new_cnt;
+      // The callback may have started or stopped timers, which moves the base.
       CORE_ENTER_ATOMIC();
+      delta_tot = sleeptimer_hal_get_counter() - last_delta_update_count;
     }
 
     if (timer_head) {
-      timer_head->delta -= delta_tot;
-      last_delta_update_count = current_cnt;
-
+      update_first_timer_delta();
       set_comparator_for_next_timer();
     } else {
       sleeptimer_hal_disable_int(SLEEPTIMER_EVENT_COMP);
     }
     CORE_EXIT_ATOMIC();
   }
+#endif
+
+  irq_ticks = sleeptimer_hal_get_counter() - irq_start_cnt;
+  if (irq_ticks > deferred_stats.irq_ticks_max) {
+    deferred_stats.irq_ticks_max = irq_ticks;
+  }
+}
+
+/*******************************************************************************
+ * Runs the callback of an expired timer, or queues it for
+ * sl_sleeptimer_run_deferred_callbacks(). Called from the timer interrupt,
+ * the only producer of the deferred queue.
+ *
+ * @param handle Pointer to handle to timer.
+ ******************************************************************************/
+static void run_timer_callback(sl_sleeptimer_timer_handle_t *handle)
+{
+  uint8_t head = deferred_head;
+  uint32_t depth;
+
+  if (handle->callback == NULL) {
+    return;
+  }
+
+  if ((handle->option_flags & SL_SLEEPTIMER_DEFERRED_CALLBACK_FLAG) != 0u) {
+    depth = (uint8_t)(head - deferred_tail);
+    if (depth < SL_SLEEPTIMER_DEFERRED_QUEUE_SIZE) {
+      deferred_queue[head % SL_SLEEPTIMER_DEFERRED_QUEUE_SIZE].handle = handle;
+      deferred_queue[head % SL_SLEEPTIMER_DEFERRED_QUEUE_SIZE].callback = handle->callback;
+      deferred_queue[head % SL_SLEEPTIMER_DEFERRED_QUEUE_SIZE].callback_data = handle->callback_data;
+      // Publish the entry only once it is complete.
+      __DMB();
+      deferred_head = head + 1u;
+      if (depth + 1u > deferred_stats.queue_depth_max) {
+        deferred_stats.queue_depth_max = depth + 1u;
+      }
+      return;
+    }
+    // Running late in the interrupt beats losing an expiry.
+    deferred_stats.queue_full_count++;
+  }
+
+  handle->callback(handle, handle->callback_data);
 }
 
 /*******************************************************************************
@@ -1000,6 +1550,174 @@ static void delay_callback(sl_sleeptimer_timer_handle_t *handle,
   *wait_flag = false;
 }
 
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+/*******************************************************************************
+ * Finds the list a timer expiring at the given count belongs to.
+ *
+ * @param expiry Expiry count of the timer.
+ * @param level Set to the wheel level, WHEEL_LEVELS for the wrapped list.
+ * @param slot Set to the slot within the level.
+ *
+ * @return Pointer to the head of the list.
+ ******************************************************************************/
+static sl_sleeptimer_timer_handle_t **wheel_locate(sl_sleeptimer_tick_count_t expiry,
+                                                   uint32_t *level,
+                                                   uint32_t *slot)
+{
+  sl_sleeptimer_tick_count_t diff = expiry ^ wheel_time;
+
+  if (expiry < wheel_time) {
+    *level = WHEEL_LEVELS;
+    *slot = 0u;
+    return &wheel_wrapped;
+  }
+
+  *level = (diff == 0u) ? 0u : div_to_log2(diff) / WHEEL_SLOT_BITS;
+  *slot = (expiry >> (*level * WHEEL_SLOT_BITS)) & WHEEL_SLOT_MASK;
+  return &wheel[*level][*slot];
+}
+
+/*******************************************************************************
+ * Inserts a timer in the timing wheel.
+ *
+ * @param handle Pointer to handle to timer.
+ * @param expiry Counter value the timer expires at.
+ ******************************************************************************/
+static void wheel_insert_timer(sl_sleeptimer_timer_handle_t *handle,
+                               sl_sleeptimer_tick_count_t expiry)
+{
+  uint32_t level;
+  uint32_t slot;
+  sl_sleeptimer_timer_handle_t **head = wheel_locate(expiry, &level, &slot);
+
+  handle->delta = expiry;
+  handle->next = *head;
+  *head = handle;
+  if (level < WHEEL_LEVELS) {
+    wheel_occupied[level] |= (uint16_t)(1u << slot);
+  }
+  wheel_count++;
+}
+
+/*******************************************************************************
+ * Removes a timer from the timing wheel. Only the list its expiry maps to is
+ * searched.
+ *
+ * @param handle Pointer to handle to timer.
+ *
+ * @return 0 if successful. Error code otherwise.
+ ******************************************************************************/
+static sl_status_t wheel_remove_timer(sl_sleeptimer_timer_handle_t *handle)
+{
+  uint32_t level;
+  uint32_t slot;
+  sl_sleeptimer_timer_handle_t **link = wheel_locate(handle->delta, &level, &slot);
+
+  while (*link != NULL && *link != handle) {
+    link = &(*link)->next;
+  }
+  if (*link != handle) {
+    return SL_STATUS_INVALID_STATE;
+  }
+
+  *link = handle->next;
+  if (level < WHEEL_LEVELS && wheel[level][slot] == NULL) {
+    wheel_occupied[level] &= (uint16_t)~(1u << slot);
+  }
+  wheel_count--;
+
+  return SL_STATUS_OK;
+}
+
+/*******************************************************************************
+ * Checks if a timer is in the timing wheel.
+ *
+ * @param handle Pointer to handle to timer.
+ *
+ * @return true if the timer is running.
+ ******************************************************************************/
+static bool wheel_has_timer(sl_sleeptimer_timer_handle_t *handle)
+{
+  uint32_t level;
+  uint32_t slot;
+  sl_sleeptimer_timer_handle_t *current = *wheel_locate(handle->delta, &level, &slot);
+
+  while (current != NULL && current != handle) {
+    current = current->next;
+  }
+  return current == handle;
+}
+
+/*******************************************************************************
+ * Gets the timer that expires first.
+ *
+ * @return Pointer to handle to timer, NULL if the wheel is empty. Among
+ *         timers expiring on the same count, the one with highest priority.
+ ******************************************************************************/
+static sl_sleeptimer_timer_handle_t *wheel_next_timer(void)
+{
+  sl_sleeptimer_timer_handle_t *current = wheel_wrapped;
+  sl_sleeptimer_timer_handle_t *first = NULL;
+
+  for (uint32_t level = 0u; level < WHEEL_LEVELS; level++) {
+    if (wheel_occupied[level] != 0u) {
+      uint32_t occupied = wheel_occupied[level];
+      // Lowest occupied slot holds the earliest timers of the level.
+      current = wheel[level][div_to_log2(occupied & (0u - occupied))];
+      break;
+    }
+  }
+
+  while (current != NULL) {
+    if (first == NULL
+        || current->delta - wheel_time < first->delta - wheel_time
+        || (current->delta == first->delta
+            && current->priority < first->priority)) {
+      first = current;
+    }
+    current = current->next;
+  }
+  return first;
+}
+
+/*******************************************************************************
+ * Moves the wheel forward. Only the timers of the slot the new count enters
+ * move to lower levels.
+ *
+ * @param count New wheel time, not past the expiry of the first timer.
+ ******************************************************************************/
+static void wheel_advance(sl_sleeptimer_tick_count_t count)
+{
+  sl_sleeptimer_timer_handle_t *current;
+  sl_sleeptimer_timer_handle_t *next;
+  sl_sleeptimer_tick_count_t diff = count ^ wheel_time;
+
+  if (diff == 0u) {
+    return;
+  }
+
+  if (count < wheel_time) {
+    // Counter wrapped, every running timer is in the wrapped list.
+    current = wheel_wrapped;
+    wheel_wrapped = NULL;
+  } else {
+    uint32_t level = div_to_log2(diff) / WHEEL_SLOT_BITS;
+    uint32_t slot = (count >> (level * WHEEL_SLOT_BITS)) & WHEEL_SLOT_MASK;
+
+    current = wheel[level][slot];
+    wheel[level][slot] = NULL;
+    wheel_occupied[level] &= (uint16_t)~(1u << slot);
+  }
+
+  wheel_time = count;
+  while (current != NULL) {
+    next = current->next;
+    wheel_count--;
+    wheel_insert_timer(current, current->delta);
+    current = next;
+  }
+}
+#else
 /*******************************************************************************
  * Inserts a timer in the delta list.
  *
@@ -1079,6 +1797,46 @@ static sl_status_t delta_list_remove_timer(sl_sleeptimer_timer_handle_t *handle)
   return SL_STATUS_OK;
 }
 
+#endif
+
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+/*******************************************************************************
+ * Finds the first timer without a slack in the timing wheel, other than the
+ * given one. Levels and slots are visited in expiry order, so the walk stops
+ * at the first list that holds one.
+ *
+ * @param first Timer to skip, the one the wakeup is set for.
+ *
+ * @return Pointer to handle to timer, NULL if there is none.
+ ******************************************************************************/
+static sl_sleeptimer_timer_handle_t *wheel_next_strict_timer(sl_sleeptimer_timer_handle_t *first)
+{
+  sl_sleeptimer_timer_handle_t *found = NULL;
+
+  for (uint32_t list = 0u; list <= WHEEL_LEVELS * WHEEL_SLOTS && found == NULL; list++) {
+    sl_sleeptimer_timer_handle_t *current;
+
+    if (list < WHEEL_LEVELS * WHEEL_SLOTS) {
+      if ((wheel_occupied[list / WHEEL_SLOTS] & (1u << (list % WHEEL_SLOTS))) == 0u) {
+        continue;
+      }
+      current = wheel[list / WHEEL_SLOTS][list % WHEEL_SLOTS];
+    } else {
+      current = wheel_wrapped;
+    }
+
+    for (; current != NULL; current = current->next) {
+      if (current != first && get_timer_slack(current) == 0u
+          && (found == NULL
+              || current->delta - wheel_time < found->delta - wheel_time)) {
+        found = current;
+      }
+    }
+  }
+  return found;
+}
+#endif
+
 /*******************************************************************************
  * Sets comparator for next timer.
  ******************************************************************************/
@@ -1086,7 +1844,116 @@ static void set_comparator_for_next_timer(void)
 {
   sl_sleeptimer_tick_count_t compare_value;
 
-  compare_value = last_delta_update_count + timer_head->delta;
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+  // The timers that can join the wakeup of the first one are the few with a
+  // slack, and the first timer without one, which ends the chain.
+  sl_sleeptimer_timer_handle_t *candidates[SL_SLEEPTIMER_SLACK_TIMERS_MAX + 1u];
+  sl_sleeptimer_timer_handle_t *first = wheel_next_timer();
+  sl_sleeptimer_tick_count_t expiry = first->delta - wheel_time;
+  sl_sleeptimer_tick_count_t deadline;
+  sl_sleeptimer_tick_count_t elapsed;
+  uint32_t count = 0u;
+  uint32_t folded = 0u;
+
+  // Latest count, relative to wheel_time, the first timer may run at.
+  deadline = expiry + get_timer_slack(first);
+  if (deadline < expiry) {
+    deadline = UINT32_MAX;
+  }
+
+  if (deadline != expiry) {
+    for (uint32_t i = 0u; i < SL_SLEEPTIMER_SLACK_TIMERS_MAX; i++) {
+      if (timer_slack[i].handle != NULL && timer_slack[i].handle != first
+          && wheel_has_timer(timer_slack[i].handle)) {
+        candidates[count++] = timer_slack[i].handle;
+      }
+    }
+    candidates[count] = wheel_next_strict_timer(first);
+    if (candidates[count] != NULL) {
+      count++;
+    }
+
+    // Few entries, sort them by expiry.
+    for (uint32_t i = 1u; i < count; i++) {
+      sl_sleeptimer_timer_handle_t *current = candidates[i];
+      uint32_t j = i;
+
+      while (j > 0u
+             && candidates[j - 1u]->delta - wheel_time > current->delta - wheel_time) {
+        candidates[j] = candidates[j - 1u];
+        j--;
+      }
+      candidates[j] = current;
+    }
+  }
+
+  // Fold the following timers into the same wakeup while they expire before
+  // every timer already folded runs out of slack.
+  for (uint32_t i = 0u; i < count; i++) {
+    sl_sleeptimer_tick_count_t next = candidates[i]->delta - wheel_time;
+    sl_sleeptimer_tick_count_t slack;
+
+    if (next > deadline) {
+      break;
+    }
+    if (next != expiry) {
+      folded++;
+    }
+    expiry = next;
+
+    slack = get_timer_slack(candidates[i]);
+    if (slack < deadline - expiry) {
+      deadline = expiry + slack;
+    }
+  }
+
+  // Timers already waiting past their expiry run as soon as possible.
+  elapsed = sleeptimer_hal_get_counter() - wheel_time;
+  if (expiry < elapsed) {
+    expiry = elapsed;
+  }
+
+  pending_wakeups_avoided = folded;
+  compare_value = wheel_time + expiry;
+#else
+  sl_sleeptimer_timer_handle_t *current;
+  sl_sleeptimer_tick_count_t expiry = timer_head->delta;
+  sl_sleeptimer_tick_count_t deadline;
+  uint32_t folded = 0u;
+
+  // Latest count the first timer may run at.
+  deadline = expiry + get_timer_slack(timer_head);
+  if (deadline < expiry) {
+    deadline = UINT32_MAX;
+  }
+
+  // Fold the following timers into the same wakeup while they expire before
+  // every timer already folded runs out of slack.
+  for (current = timer_head->next; current != NULL; current = current->next) {
+    sl_sleeptimer_tick_count_t slack;
+
+    if (current->delta > deadline - expiry) {
+      break;
+    }
+    expiry += current->delta;
+    if (current->delta != 0u) {
+      folded++;
+    }
+
+    slack = get_timer_slack(current);
+    if (slack < deadline - expiry) {
+      deadline = expiry + slack;
+    }
+  }
+
+  // Timers already waiting past their expiry run as soon as possible.
+  if (expiry < sleeptimer_hal_get_counter() - last_delta_update_count) {
+    expiry = sleeptimer_hal_get_counter() - last_delta_update_count;
+  }
+
+  pending_wakeups_avoided = folded;
+  compare_value = last_delta_update_count + expiry;
+#endif
 
   sleeptimer_hal_enable_int(SLEEPTIMER_EVENT_COMP);
   sleeptimer_hal_set_compare(compare_value);
@@ -1098,6 +1965,18 @@ static void set_comparator_for_next_timer(void)
 static void update_first_timer_delta(void)
 {
   sl_sleeptimer_tick_count_t current_cnt = sleeptimer_hal_get_counter();
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+  sl_sleeptimer_timer_handle_t *first = wheel_next_timer();
+
+  // Catch up with the counter, but never past a timer waiting to be processed.
+  if (first != NULL
+      && first->delta - wheel_time < current_cnt - wheel_time) {
+    wheel_advance(first->delta);
+  } else {
+    wheel_advance(current_cnt);
+  }
+  last_delta_update_count = current_cnt;
+#else
   sl_sleeptimer_tick_count_t time_diff;
 
   if (timer_head) {
@@ -1106,12 +1985,14 @@ static void update_first_timer_delta(void)
       timer_head->delta -= time_diff;
       last_delta_update_count = current_cnt;
     } else {
-      last_delta_update_count = current_cnt - timer_head->delta;
+      // Keep the list based on the expiry of the first timer.
+      last_delta_update_count += timer_head->delta;
       timer_head->delta = 0;
     }
   } else {
     last_delta_update_count = current_cnt;
   }
+#endif
 }
 
 /*******************************************************************************
@@ -1133,12 +2014,21 @@ static void update_first_timer_delta(void)
 static sl_status_t create_timer(sl_sleeptimer_timer_handle_t *handle,
                                 sl_sleeptimer_tick_count_t timeout_initial,
                                 sl_sleeptimer_tick_count_t timeout_periodic,
+                                sl_sleeptimer_tick_count_t slack,
                                 sl_sleeptimer_timer_callback_t callback,
                                 void *callback_data,
                                 uint8_t priority,
                                 uint16_t option_flags)
 {
   CORE_DECLARE_IRQ_STATE;
+  sl_status_t error;
+
+  CORE_ENTER_ATOMIC();
+  error = set_timer_slack(handle, slack);
+  CORE_EXIT_ATOMIC();
+  if (error != SL_STATUS_OK) {
+    return error;
+  }
 
   handle->priority = priority;
   handle->callback_data = callback_data;
@@ -1161,18 +2051,94 @@ static sl_status_t create_timer(sl_sleeptimer_timer_handle_t *handle,
 
   CORE_ENTER_ATOMIC();
   update_first_timer_delta();
-  delta_list_insert_timer(handle, timeout_initial);
+#if SL_SLEEPTIMER_TIMER_WHEEL_CONFIG
+  wheel_insert_timer(handle, sleeptimer_hal_get_counter() + timeout_initial);
+
+  // Update timer comparator, the timer may also expire before the wakeup
+  // the following timers were folded into.
+  set_comparator_for_next_timer();
+#else
+  // The first timer may be waiting for a later wakeup, which holds the base
+  // of the list behind the counter.
+  delta_list_insert_timer(handle,
+                          timeout_initial
+                          + (sleeptimer_hal_get_counter() - last_delta_update_count));
+
+  // Update timer comparator, the timer may also expire before the wakeup
+  // the following timers were folded into.
+  set_comparator_for_next_timer();
+#endif
 
-  // If first timer, update timer comparator.
-  if (timer_head == handle) {
-    set_comparator_for_next_timer();
+  CORE_EXIT_ATOMIC();
+
+  return SL_STATUS_OK;
+}
+
+/*******************************************************************************
+ * Records how late a timer may expire. Must be called in an atomic section.
+ *
+ * @param handle Pointer to handle to timer.
+ * @param slack Ticks the timer may be late, 0 to forget the timer.
+ *
+ * @return 0 if successful. SL_STATUS_FULL if all entries belong to running
+ *         timers.
+ ******************************************************************************/
+static sl_status_t set_timer_slack(sl_sleeptimer_timer_handle_t *handle,
+                                   sl_sleeptimer_tick_count_t slack)
+{
+  uint32_t free_entry = SL_SLEEPTIMER_SLACK_TIMERS_MAX;
+  bool is_running;
+
+  for (uint32_t i = 0u; i < SL_SLEEPTIMER_SLACK_TIMERS_MAX; i++) {
+    if (timer_slack[i].handle == handle) {
+      timer_slack[i].handle = (slack != 0u) ? handle : NULL;
+      timer_slack[i].slack = slack;
+      return SL_STATUS_OK;
+    }
+    if (timer_slack[i].handle == NULL) {
+      free_entry = i;
+    }
   }
 
-  CORE_EXIT_ATOMIC();
+  if (slack == 0u) {
+    return SL_STATUS_OK;
+  }
+
+  // Entries of timers that stopped or expired can be taken over.
+  for (uint32_t i = 0u;
+       i < SL_SLEEPTIMER_SLACK_TIMERS_MAX && free_entry == SL_SLEEPTIMER_SLACK_TIMERS_MAX;
+       i++) {
+    sl_sleeptimer_is_timer_running(timer_slack[i].handle, &is_running);
+    if (!is_running) {
+      free_entry = i;
+    }
+  }
+  if (free_entry == SL_SLEEPTIMER_SLACK_TIMERS_MAX) {
+    return SL_STATUS_FULL;
+  }
 
+  timer_slack[free_entry].handle = handle;
+  timer_slack[free_entry].slack = slack;
   return SL_STATUS_OK;
 }
 
+/*******************************************************************************
+ * Gets how late a timer may expire.
+ *
+ * @param handle Pointer to handle to timer.
+ *
+ * @return Slack of the timer, in ticks.
+ ******************************************************************************/
+static sl_sleeptimer_tick_count_t get_timer_slack(sl_sleeptimer_timer_handle_t *handle)
+{
+  for (uint32_t i = 0u; i < SL_SLEEPTIMER_SLACK_TIMERS_MAX; i++) {
+    if (timer_slack[i].handle == handle) {
+      return timer_slack[i].slack;
+    }
+  }
+  return 0u;
+}
+
 /*******************************************************************************
  * Convert dividend to logarithmic value. It only works for even
  * numbers equal to 2^n.
@@ -1328,6 +2294,43 @@ static bool is_valid_date(sl_sleeptimer_date_t *date)
 
   return true;
 }
+
+/*******************************************************************************
+ * Checks if the date is valid for the 64 bits time conversion.
+ *
+ * @param date Date to check.
+ *
+ * @return true if the date is valid. False otherwise.
+ ******************************************************************************/
+static bool is_valid_date_ms64(sl_sleeptimer_date_t *date)
+{
+  if ((date == NULL)
+      || (date->year < TIME_NTP_UNIX_EPOCH_DIFF)
+      || (date->year > SL_SLEEPTIMER_WALLCLOCK64_YEAR_MAX - TIME_NTP_EPOCH)
+      || (date->month > MONTH_DECEMBER)
+      || (date->month_day == 0
+          || date->month_day > days_in_month[is_leap_year(date->year + TIME_NTP_EPOCH)][date->month])
+      || (date->hour > 23)
+      || (date->min > 59)
+      || (date->sec > 59)) {
+    return false;
+  }
+
+  return true;
+}
+
+/*******************************************************************************
+ * Gets the 64 bits tick count in milliseconds.
+ *
+ * @return Milliseconds since the sleeptimer was initialized.
+ ******************************************************************************/
+static uint64_t get_tick_ms64(void)
+{
+  uint64_t ms = 0u;
+
+  sl_sleeptimer_tick64_to_ms(sl_sleeptimer_get_tick_count64(), &ms);
+  return ms;
+}
 #endif
 
 /// @endcond
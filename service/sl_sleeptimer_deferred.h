@@ -0,0 +1,63 @@
+/*
+ * sl_sleeptimer_deferred.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+#ifndef SL_SLEEPTIMER_DEFERRED_H
+#define SL_SLEEPTIMER_DEFERRED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "sl_sleeptimer.h"
+
+// Option flag of a timer whose callback runs from
+// sl_sleeptimer_run_deferred_callbacks() instead of the RTC interrupt.
+#define SL_SLEEPTIMER_DEFERRED_CALLBACK_FLAG    0x8000u
+
+// Number of callbacks that can wait at the same time. Must be a power of two,
+// at most 128.
+#ifndef SL_SLEEPTIMER_DEFERRED_QUEUE_SIZE
+#define SL_SLEEPTIMER_DEFERRED_QUEUE_SIZE       8u
+#endif
+
+/// @brief Timer interrupt statistics.
+typedef struct {
+  uint32_t irq_ticks_max;       ///< Longest run of the timer interrupt processing, in timer ticks.
+  uint32_t queue_depth_max;     ///< Most deferred callbacks waiting at the same time.
+  uint32_t queue_full_count;    ///< Deferred callbacks run in the interrupt because the queue was full.
+} sl_sleeptimer_deferred_stats_t;
+
+/***************************************************************************//**
+ * Runs the callbacks of expired timers that have the
+ * SL_SLEEPTIMER_DEFERRED_CALLBACK_FLAG option flag, oldest first.
+ *
+ * Must only be called from one context, normally the main loop after each
+ * wakeup. A callback that was queued before its timer was stopped still
+ * runs.
+ *
+ * @return Number of callbacks run.
+ ******************************************************************************/
+uint32_t sl_sleeptimer_run_deferred_callbacks(void);
+
+/***************************************************************************//**
+ * Checks if deferred callbacks are waiting.
+ *
+ * @return true if sl_sleeptimer_run_deferred_callbacks() has work to do.
+ ******************************************************************************/
+bool sl_sleeptimer_has_deferred_callbacks(void);
+
+/***************************************************************************//**
+ * Gets the timer interrupt statistics.
+ *
+ * @param stats Pointer to statistics structure.
+ ******************************************************************************/
+void sl_sleeptimer_get_deferred_stats(sl_sleeptimer_deferred_stats_t *stats);
+
+/***************************************************************************//**
+ * Clears the timer interrupt statistics.
+ ******************************************************************************/
+void sl_sleeptimer_reset_deferred_stats(void);
+
+#endif /* SL_SLEEPTIMER_DEFERRED_H */
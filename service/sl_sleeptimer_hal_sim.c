@@ -0,0 +1,292 @@
+/*
+ * sl_sleeptimer_hal_sim.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "em_core.h"
+#include "sl_sleeptimer.h"
+#include "sl_sleeptimer_hal.h"
+#include "sl_sleeptimer_hal_sim.h"
+
+// Host replacement for sl_sleeptimer_hal_rtc.c. It models the 24 bits RTC
+// register by register (counter, compare channel B, interrupt flags and
+// enables), so the overflow extension and the compare margin of the real HAL
+// run unchanged on a virtual counter.
+#if defined(SL_SLEEPTIMER_HAL_SIM)
+
+#define SIM_IF_OF                 (1u << 0)
+#define SIM_IF_COMP               (1u << 1)
+
+#define SLEEPTIMER_COMPARE_MIN_DIFF  2
+
+#define SLEEPTIMER_TMR_WIDTH      (0xFFFFFFu)
+#define SLEEPTIMER_TMR_BIT_WIDTH  24u
+
+// Simulated RTC registers.
+static uint32_t sim_cnt;
+static uint32_t sim_comp;
+static uint32_t sim_if;
+static uint32_t sim_ien;
+
+// Ticks between an enabled flag and its handler, and ticks left until the
+// pending handler runs.
+static uint32_t sim_latency = 0u;
+static uint32_t sim_irq_wait;
+static bool sim_irq_pending = false;
+static uint32_t sim_irq_count = 0u;
+
+static volatile uint8_t rtc_overflow_count = 0;
+static volatile uint32_t compare_value_32 = 0;
+static bool comp_int_disabled = true;
+
+static void sim_irq_handler(void);
+
+/******************************************************************************
+ * Initializes simulated RTC sleep timer.
+ *****************************************************************************/
+void sleeptimer_hal_init_timer()
+{
+  sim_cnt = 0u;
+  sim_comp = 0u;
+  sim_if = 0u;
+  sim_ien = 0u;
+  sim_irq_pending = false;
+  rtc_overflow_count = 0u;
+  compare_value_32 = 0u;
+  comp_int_disabled = true;
+}
+
+/******************************************************************************
+ * Gets simulated RTC counter.
+ *****************************************************************************/
+uint32_t sleeptimer_hal_get_counter(void)
+{
+  uint32_t tick_cnt;
+  uint16_t of_cnt;
+
+  tick_cnt = sim_cnt;
+  of_cnt = rtc_overflow_count;
+
+  if (sim_if & SIM_IF_OF) {
+    tick_cnt = sim_cnt;
+    of_cnt++;
+  }
+
+  return tick_cnt | ((uint32_t)of_cnt << SLEEPTIMER_TMR_BIT_WIDTH);
+}
+
+/******************************************************************************
+ * Gets simulated RTC compare value
+ *****************************************************************************/
+uint32_t sleeptimer_hal_get_compare(void)
+{
+  return compare_value_32;
+}
+
+/******************************************************************************
+ * Sets simulated RTC compare value
+ *****************************************************************************/
+void sleeptimer_hal_set_compare(uint32_t value)
+{
+  uint32_t counter = sleeptimer_hal_get_counter();
+  uint32_t compare_value = value;
+  if (((sim_if & SIM_IF_COMP) != 0)
+      || compare_value_32 - counter > SLEEPTIMER_COMPARE_MIN_DIFF
+      || compare_value_32 == counter) {
+    // Add margin if necessary
+    if (compare_value - counter < SLEEPTIMER_COMPARE_MIN_DIFF) {
+      compare_value = counter + SLEEPTIMER_COMPARE_MIN_DIFF;
+    }
+
+    compare_value_32 = compare_value;
+    if (compare_value_32 - counter <= SLEEPTIMER_TMR_WIDTH) {
+      sim_comp = compare_value_32 % (SLEEPTIMER_TMR_WIDTH + 1);
+      sleeptimer_hal_enable_int(SLEEPTIMER_EVENT_COMP);
+    } else {
+      sleeptimer_hal_disable_int(SLEEPTIMER_EVENT_COMP);
+    }
+  }
+}
+
+/******************************************************************************
+ * Enables simulated RTC interrupts.
+ *****************************************************************************/
+void sleeptimer_hal_enable_int(uint8_t local_flag)
+{
+  if (local_flag & SLEEPTIMER_EVENT_OF) {
+    sim_ien |= SIM_IF_OF;
+  }
+
+  if (local_flag & SLEEPTIMER_EVENT_COMP) {
+    if (comp_int_disabled == true) {
+      sim_if &= ~SIM_IF_COMP;
+      comp_int_disabled = false;
+    }
+
+    sim_ien |= SIM_IF_COMP;
+  }
+}
+
+/******************************************************************************
+ * Disables simulated RTC interrupts.
+ *****************************************************************************/
+void sleeptimer_hal_disable_int(uint8_t local_flag)
+{
+  if (local_flag & SLEEPTIMER_EVENT_OF) {
+    sim_ien &= ~SIM_IF_OF;
+  }
+
+  if (local_flag & SLEEPTIMER_EVENT_COMP) {
+    sim_ien &= ~SIM_IF_COMP;
+    comp_int_disabled = true;
+  }
+}
+
+/******************************************************************************
+ * Gets status of specified interrupt.
+ *****************************************************************************/
+bool sleeptimer_hal_is_int_status_set(uint8_t local_flag)
+{
+  bool int_is_set = false;
+
+  switch (local_flag) {
+    case SLEEPTIMER_EVENT_COMP:
+      int_is_set = ((sim_if & SIM_IF_COMP) == SIM_IF_COMP);
+      break;
+
+    case SLEEPTIMER_EVENT_OF:
+      int_is_set = ((sim_if & SIM_IF_OF) == SIM_IF_OF)
+                   && (((rtc_overflow_count << SLEEPTIMER_TMR_BIT_WIDTH) + SLEEPTIMER_TMR_WIDTH) == UINT32_MAX);
+      break;
+
+    default:
+      break;
+  }
+
+  return int_is_set;
+}
+
+/*******************************************************************************
+ * Gets simulated RTC timer frequency.
+ ******************************************************************************/
+uint32_t sleeptimer_hal_get_timer_frequency(void)
+{
+  return SL_SLEEPTIMER_HAL_SIM_FREQUENCY;
+}
+
+/*******************************************************************************
+ * Moves the simulated RTC forward.
+ ******************************************************************************/
+void sl_sleeptimer_hal_sim_advance(uint32_t ticks)
+{
+  while (ticks > 0u) {
+    uint32_t step = ticks;
+    uint32_t to_overflow = (SLEEPTIMER_TMR_WIDTH + 1u) - sim_cnt;
+    uint32_t to_compare = ((sim_comp - sim_cnt - 1u) & SLEEPTIMER_TMR_WIDTH) + 1u;
+
+    // Stop at the next tick something happens on.
+    if (to_overflow < step) {
+      step = to_overflow;
+    }
+    if (to_compare < step) {
+      step = to_compare;
+    }
+    if (sim_irq_pending && sim_irq_wait < step) {
+      step = sim_irq_wait;
+    }
+
+    ticks -= step;
+    if (sim_irq_pending) {
+      sim_irq_wait -= step;
+    }
+    sim_cnt = (sim_cnt + step) & SLEEPTIMER_TMR_WIDTH;
+    if (sim_cnt == 0u) {
+      sim_if |= SIM_IF_OF;
+    }
+    if (sim_cnt == sim_comp) {
+      sim_if |= SIM_IF_COMP;
+    }
+
+    if (!sim_irq_pending && (sim_if & sim_ien) != 0u) {
+      sim_irq_pending = true;
+      sim_irq_wait = sim_latency;
+    }
+    // The handler may raise or enable another interrupt.
+    while (sim_irq_pending && sim_irq_wait == 0u) {
+      sim_irq_pending = false;
+      sim_irq_handler();
+      if ((sim_if & sim_ien) != 0u) {
+        sim_irq_pending = true;
+        sim_irq_wait = sim_latency;
+      }
+    }
+  }
+}
+
+/*******************************************************************************
+ * Sets the simulated interrupt latency.
+ ******************************************************************************/
+void sl_sleeptimer_hal_sim_set_latency(uint32_t ticks)
+{
+  sim_latency = ticks;
+}
+
+/*******************************************************************************
+ * Sets the extended simulated counter.
+ ******************************************************************************/
+void sl_sleeptimer_hal_sim_set_counter(uint32_t count)
+{
+  sim_cnt = count & SLEEPTIMER_TMR_WIDTH;
+  rtc_overflow_count = (uint8_t)(count >> SLEEPTIMER_TMR_BIT_WIDTH);
+}
+
+/*******************************************************************************
+ * Gets the number of simulated interrupts.
+ ******************************************************************************/
+uint32_t sl_sleeptimer_hal_sim_get_irq_count(void)
+{
+  return sim_irq_count;
+}
+
+/*******************************************************************************
+ * Simulated RTC interrupt handler, same flow as RTC_IRQHandler.
+ ******************************************************************************/
+static void sim_irq_handler(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+  uint8_t local_flag = 0;
+  uint32_t irq_flag;
+  uint32_t compare_value_24 = 0;
+
+  CORE_ENTER_ATOMIC();
+  sim_irq_count++;
+  irq_flag = sim_if;
+
+  if (irq_flag & SIM_IF_OF) {
+    if (((rtc_overflow_count << SLEEPTIMER_TMR_BIT_WIDTH) + SLEEPTIMER_TMR_WIDTH) == UINT32_MAX) {
+      local_flag |= SLEEPTIMER_EVENT_OF;
+    }
+    rtc_overflow_count++;
+    compare_value_24 = compare_value_32;
+    compare_value_24 -= (rtc_overflow_count << SLEEPTIMER_TMR_BIT_WIDTH);
+    if (compare_value_24 <= SLEEPTIMER_TMR_WIDTH) {
+      sim_comp = compare_value_24;
+      sleeptimer_hal_enable_int(SLEEPTIMER_EVENT_COMP);
+    }
+  }
+  if (irq_flag & SIM_IF_COMP) {
+    local_flag |= SLEEPTIMER_EVENT_COMP;
+  }
+  sim_if &= ~(irq_flag & (SIM_IF_OF | SIM_IF_COMP));
+
+  if (local_flag != 0) {
+    process_timer_irq(local_flag);
+  }
+  CORE_EXIT_ATOMIC();
+}
+
+#endif
@@ -0,0 +1,51 @@
+/*
+ * sl_sleeptimer_hal_sim.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+#ifndef SL_SLEEPTIMER_HAL_SIM_H
+#define SL_SLEEPTIMER_HAL_SIM_H
+
+#include <stdint.h>
+
+// Frequency reported by the simulated RTC.
+#ifndef SL_SLEEPTIMER_HAL_SIM_FREQUENCY
+#define SL_SLEEPTIMER_HAL_SIM_FREQUENCY         32768u
+#endif
+
+/***************************************************************************//**
+ * Moves the simulated RTC forward.
+ *
+ * The counter jumps from one event (overflow, compare match, interrupt
+ * service) to the next, so long periods without a timer cost no more than
+ * short ones. Every interrupt the real RTC would raise is serviced, late by
+ * the configured latency.
+ *
+ * @param ticks Number of ticks to advance.
+ ******************************************************************************/
+void sl_sleeptimer_hal_sim_advance(uint32_t ticks);
+
+/***************************************************************************//**
+ * Sets the delay between an RTC event and the run of its interrupt handler.
+ *
+ * @param ticks Interrupt latency, in ticks. 0 runs the handler on the tick
+ *        the flag is raised.
+ ******************************************************************************/
+void sl_sleeptimer_hal_sim_set_latency(uint32_t ticks);
+
+/***************************************************************************//**
+ * Sets the extended 32 bits counter, e.g. just before an overflow of the 24
+ * bits RTC. Must be called after sl_sleeptimer_init() and before any timer
+ * is started.
+ *
+ * @param count New counter value.
+ ******************************************************************************/
+void sl_sleeptimer_hal_sim_set_counter(uint32_t count);
+
+/***************************************************************************//**
+ * Gets the number of times the interrupt handler has run.
+ ******************************************************************************/
+uint32_t sl_sleeptimer_hal_sim_get_irq_count(void);
+
+#endif /* SL_SLEEPTIMER_HAL_SIM_H */
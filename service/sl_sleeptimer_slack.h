@@ -0,0 +1,139 @@
+/*
+ * sl_sleeptimer_slack.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+#ifndef SL_SLEEPTIMER_SLACK_H
+#define SL_SLEEPTIMER_SLACK_H
+
+#include <stdint.h>
+
+#include "sl_sleeptimer.h"
+
+// Number of timers that can have a slack at the same time.
+#ifndef SL_SLEEPTIMER_SLACK_TIMERS_MAX
+#define SL_SLEEPTIMER_SLACK_TIMERS_MAX          4
+#endif
+
+/***************************************************************************//**
+ * Starts a 32 bits timer that may expire up to slack ticks late.
+ *
+ * Timers whose windows overlap run from a single RTC interrupt, at the last
+ * of their expiries that still lies within every window. The other start
+ * functions set the slack of the timer back to 0. Both timer stores fold
+ * expiries this way.
+ *
+ * @param handle Pointer to handle to timer.
+ * @param timeout Timer timeout, in timer ticks.
+ * @param slack Ticks the timer may expire late.
+ * @param callback Callback function that will be called when
+ *        initial/periodic timeout expires.
+ * @param callback_data Pointer to user data that will be passed to callback.
+ * @param priority Priority of callback. Useful in case multiple timer expire
+ *        at the same time. 0 = highest priority.
+ * @param option_flags Bit array of option flags for the timer.
+ *
+ * @return 0 if successful. SL_STATUS_FULL if SL_SLEEPTIMER_SLACK_TIMERS_MAX
+ *         running timers already have a slack. Error code otherwise.
+ ******************************************************************************/
+sl_status_t sl_sleeptimer_start_timer_slack(sl_sleeptimer_timer_handle_t *handle,
+                                            uint32_t timeout,
+                                            uint32_t slack,
+                                            sl_sleeptimer_timer_callback_t callback,
+                                            void *callback_data,
+                                            uint8_t priority,
+                                            uint16_t option_flags);
+
+/***************************************************************************//**
+ * Starts a 32 bits periodic timer that may expire up to slack ticks late.
+ *
+ * Running late does not shift the period, each timeout is still counted from
+ * the previous expiry.
+ *
+ * @param handle Pointer to handle to timer.
+ * @param timeout Timer periodic timeout, in timer ticks.
+ * @param slack Ticks each expiry may be late.
+ * @param callback Callback function that will be called when
+ *        initial/periodic timeout expires.
+ * @param callback_data Pointer to user data that will be passed to callback.
+ * @param priority Priority of callback. Useful in case multiple timer expire
+ *        at the same time. 0 = highest priority.
+ * @param option_flags Bit array of option flags for the timer.
+ *
+ * @return 0 if successful. SL_STATUS_FULL if SL_SLEEPTIMER_SLACK_TIMERS_MAX
+ *         running timers already have a slack. Error code otherwise.
+ ******************************************************************************/
+sl_status_t sl_sleeptimer_start_periodic_timer_slack(sl_sleeptimer_timer_handle_t *handle,
+                                                     uint32_t timeout,
+                                                     uint32_t slack,
+                                                     sl_sleeptimer_timer_callback_t callback,
+                                                     void *callback_data,
+                                                     uint8_t priority,
+                                                     uint16_t option_flags);
+
+/***************************************************************************//**
+ * Gets the number of RTC wakeups saved by running timers late.
+ *
+ * @return Expiries that were served by the wakeup of an earlier timer
+ *         instead of their own compare match.
+ ******************************************************************************/
+uint32_t sl_sleeptimer_get_wakeups_avoided(void);
+
+/***************************************************************************//**
+ * Starts a 32 bits timer that may expire up to slack milliseconds late.
+ ******************************************************************************/
+__STATIC_INLINE sl_status_t sl_sleeptimer_start_timer_slack_ms(sl_sleeptimer_timer_handle_t *handle,
+                                                               uint32_t timeout_ms,
+                                                               uint32_t slack_ms,
+                                                               sl_sleeptimer_timer_callback_t callback,
+                                                               void *callback_data,
+                                                               uint8_t priority,
+                                                               uint16_t option_flags)
+{
+  uint32_t timeout;
+  uint32_t slack;
+  sl_status_t status;
+
+  status = sl_sleeptimer_ms32_to_tick(timeout_ms, &timeout);
+  if (status == SL_STATUS_OK) {
+    status = sl_sleeptimer_ms32_to_tick(slack_ms, &slack);
+  }
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  return sl_sleeptimer_start_timer_slack(handle, timeout, slack, callback,
+                                         callback_data, priority, option_flags);
+}
+
+/***************************************************************************//**
+ * Starts a 32 bits periodic timer that may expire up to slack milliseconds
+ * late.
+ ******************************************************************************/
+__STATIC_INLINE sl_status_t sl_sleeptimer_start_periodic_timer_slack_ms(sl_sleeptimer_timer_handle_t *handle,
+                                                                        uint32_t timeout_ms,
+                                                                        uint32_t slack_ms,
+                                                                        sl_sleeptimer_timer_callback_t callback,
+                                                                        void *callback_data,
+                                                                        uint8_t priority,
+                                                                        uint16_t option_flags)
+{
+  uint32_t timeout;
+  uint32_t slack;
+  sl_status_t status;
+
+  status = sl_sleeptimer_ms32_to_tick(timeout_ms, &timeout);
+  if (status == SL_STATUS_OK) {
+    status = sl_sleeptimer_ms32_to_tick(slack_ms, &slack);
+  }
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  return sl_sleeptimer_start_periodic_timer_slack(handle, timeout, slack,
+                                                  callback, callback_data,
+                                                  priority, option_flags);
+}
+
+#endif /* SL_SLEEPTIMER_SLACK_H */
@@ -0,0 +1,67 @@
+/*
+ * sl_sleeptimer_wallclock64.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+#ifndef SL_SLEEPTIMER_WALLCLOCK64_H
+#define SL_SLEEPTIMER_WALLCLOCK64_H
+
+#include <stdint.h>
+
+#include "sl_sleeptimer.h"
+
+// Last year the 64 bits date conversions accept.
+#define SL_SLEEPTIMER_WALLCLOCK64_YEAR_MAX      9999u
+
+/***************************************************************************//**
+ * Retrieves current 64 bits time.
+ *
+ * @return Milliseconds since January 1, 1970, 00:00 UTC.
+ ******************************************************************************/
+uint64_t sl_sleeptimer_get_time_ms64(void);
+
+/***************************************************************************//**
+ * Sets current 64 bits time.
+ *
+ * The 32 bits wallclock (sl_sleeptimer_get_time) follows as long as the time
+ * still fits a Unix timestamp.
+ *
+ * @param time_ms Milliseconds since January 1, 1970, 00:00 UTC.
+ *
+ * @return 0 if successful. Error code otherwise.
+ ******************************************************************************/
+sl_status_t sl_sleeptimer_set_time_ms64(uint64_t time_ms);
+
+/***************************************************************************//**
+ * Converts a 64 bits time into a date structure, without iterating over
+ * years or months.
+ *
+ * @param time_ms Milliseconds since January 1, 1970, 00:00 UTC.
+ * @param time_zone Offset of the local time, in seconds.
+ * @param date Pointer to date structure, filled with the local date.
+ * @param millisecond Pointer set to the milliseconds of the second. Can be
+ *        NULL.
+ *
+ * @return 0 if successful. Error code otherwise.
+ ******************************************************************************/
+sl_status_t sl_sleeptimer_convert_time_ms64_to_date(uint64_t time_ms,
+                                                   sl_sleeptimer_time_zone_offset_t time_zone,
+                                                   sl_sleeptimer_date_t *date,
+                                                   uint16_t *millisecond);
+
+/***************************************************************************//**
+ * Converts a date structure into a 64 bits time, without iterating over years
+ * or months.
+ *
+ * @param date Pointer to local date structure. date->time_zone gives its
+ *        offset, in seconds.
+ * @param time_ms Pointer set to the milliseconds since January 1, 1970,
+ *        00:00 UTC.
+ *
+ * @return 0 if successful. Error code otherwise.
+ ******************************************************************************/
+sl_status_t sl_sleeptimer_convert_date_to_time_ms64(sl_sleeptimer_date_t *date,
+                                                   uint64_t *time_ms);
+
+#endif /* SL_SLEEPTIMER_WALLCLOCK64_H */
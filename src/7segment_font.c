@@ -9,24 +9,18 @@
 #include "glib.h"
 #include "extra_fonts.h"
 
-static const uint16_t font4x8_segment[] = {0x0000,0x003F,0x03FF,0x0FFC,0x03CF,0x03FF,0x03FF,0x003F,0x00CF,0x00F3,0x03F0,0x03F0,0x0000,0x0000,0x0000,0x03F0,0x03FF,0x003F,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x0000,0x0000,0x03F0,0x0000,0x003F,0x03FF,0x0FFF,0x03FF,0x03FF,0x03FF,0x00FF,0x03FF,0x03FF,0x03FF,0x03FF,0x003F,0x03F0,0x03FF,0x003F,0x0FFF,0x0F3F,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x0F0F,0x03FF,0x03FF,0x03FF,0x00C3,0x003F,0x00C3,0x00FC,0x0000,0x003F,0x03FF,0x03FF,0x03FF,0x00FF,0x03FF,0x03FF,0x03FF,0x03FF,0x003F,0x03F0,0x03FF,0x003F,0x0FFF,0x0F3F,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x0F0F,0x03FF,0x03FF,0x03FF,0x030C,0x0033,0x00C3,0x0FFF,0x0000,
-		0x0000,0x003F,0x03FF,0x0FFC,0x03CF,0x03FF,0x03FF,0x003F,0x00CF,0x00F3,0x03F0,0x03F0,0x0000,0x0000,0x0000,0x03F0,0x03FF,0x003F,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x0000,0x0000,0x03F0,0x0000,0x003F,0x03FF,0x0FFF,0x03FF,0x03FF,0x03FF,0x00FF,0x03FF,0x03FF,0x03FF,0x03FF,0x003F,0x03F0,0x03FF,0x003F,0x0FFF,0x0F3F,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x0F0F,0x03FF,0x03FF,0x03FF,0x00C3,0x003F,0x00C3,0x00FC,0x0000,0x003F,0x03FF,0x03FF,0x03FF,0x00FF,0x03FF,0x03FF,0x03FF,0x03FF,0x003F,0x03F0,0x03FF,0x003F,0x0FFF,0x0F3F,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x03FF,0x0F0F,0x03FF,0x03FF,0x03FF,0x030C,0x0033,0x00C3,0x0FFF,0x0000,
-		0x0000,0x0033,0x0333,0x0CCF,0x0303,0x0333,0x0303,0x0033,0x00F3,0x00CF,0x0F3F,0x0330,0x0000,0x0000,0x0000,0x0330,0x0303,0x0033,0x0303,0x0303,0x0333,0x0303,0x0303,0x0303,0x0303,0x0303,0x003F,0x00FC,0x033C,0x0FFF,0x00F3,0x0303,0x0C03,0x0303,0x0303,0x0303,0x03C3,0x0303,0x0303,0x0303,0x0333,0x0033,0x0330,0x0333,0x0033,0x0CF3,0x0CF3,0x0303,0x0303,0x0303,0x0303,0x0303,0x0303,0x0333,0x0333,0x0CF3,0x0333,0x0333,0x0303,0x00F3,0x0033,0x00CF,0x03CF,0x0000,0x00F3,0x0303,0x0303,0x0303,0x03C3,0x0303,0x0303,0x0303,0x0333,0x0033,0x0330,0x0333,0x0033,0x0CF3,0x0CF3,0x0303,0x0303,0x0303,0x0303,0x0303,0x0303,0x0333,0x0333,0x0CF3,0x0333,0x0333,0x0303,0x03CC,0x0033,0x00CF,0x0303,0x0000,
-		0x0000,0x0033,0x0333,0x0CCF,0x0303,0x0333,0x0303,0x0033,0x00F3,0x00CF,0x0F3F,0x0330,0x0000,0x0000,0x0000,0x0330,0x0303,0x0033,0x0303,0x0303,0x0333,0x0303,0x0303,0x0303,0x0303,0x0303,0x003F,0x00FC,0x033C,0x0FFF,0x00F3,0x0303,0x0C03,0x0303,0x0303,0x0303,0x03C3,0x0303,0x0303,0x0303,0x0333,0x0033,0x0330,0x0333,0x0033,0x0CF3,0x0CF3,0x0303,0x0303,0x0303,0x0303,0x0303,0x0303,0x0333,0x0333,0x0CF3,0x0333,0x0333,0x0303,0x00F3,0x0033,0x00CF,0x03CF,0x0000,0x00F3,0x0303,0x0303,0x0303,0x03C3,0x0303,0x0303,0x0303,0x0333,0x0033,0x0330,0x0333,0x0033,0x0CF3,0x0CF3,0x0303,0x0303,0x0303,0x0303,0x0303,0x0303,0x0333,0x0333,0x0CF3,0x0333,0x0333,0x0303,0x03CC,0x0033,0x00CF,0x0303,0x0000,
-		0x0000,0x0033,0x0333,0x0003,0x03F3,0x033F,0x0F33,0x0033,0x0033,0x00CC,0x0333,0x0F3F,0x0000,0x03FF,0x0000,0x033C,0x0333,0x0033,0x033F,0x033F,0x0333,0x03F3,0x03F3,0x033F,0x0333,0x0333,0x0033,0x00CC,0x03CF,0x0C03,0x03CF,0x033F,0x0CF3,0x0333,0x0333,0x03F3,0x0333,0x03F3,0x03F3,0x03F3,0x0333,0x0033,0x0330,0x0333,0x0033,0x0C03,0x0CC3,0x0333,0x0333,0x0333,0x0333,0x03F3,0x03CF,0x0333,0x0333,0x0CF3,0x0333,0x0333,0x033C,0x0033,0x00F3,0x00CC,0x0333,0x0000,0x00CF,0x0333,0x0333,0x03F3,0x0333,0x03F3,0x03F3,0x03F3,0x0333,0x0033,0x0330,0x0333,0x0033,0x0C03,0x0CC3,0x0333,0x0333,0x0333,0x0333,0x03F3,0x03CF,0x0333,0x0333,0x0CF3,0x0333,0x0333,0x033C,0x00CF,0x0033,0x03CC,0x0033,0x0000,
-		0x0000,0x0033,0x0333,0x0003,0x03F3,0x033F,0x0F33,0x0033,0x0033,0x00CC,0x0333,0x0F3F,0x0000,0x03FF,0x0000,0x033C,0x0333,0x0033,0x033F,0x033F,0x0333,0x03F3,0x03F3,0x033F,0x0333,0x0333,0x0033,0x00CC,0x03CF,0x0C03,0x03CF,0x033F,0x0CF3,0x0333,0x0333,0x03F3,0x0333,0x03F3,0x03F3,0x03F3,0x0333,0x0033,0x0330,0x0333,0x0033,0x0C03,0x0CC3,0x0333,0x0333,0x0333,0x0333,0x03F3,0x03CF,0x0333,0x0333,0x0CF3,0x0333,0x0333,0x033C,0x0033,0x00F3,0x00CC,0x0333,0x0000,0x00CF,0x0333,0x0333,0x03F3,0x0333,0x03F3,0x03F3,0x03F3,0x0333,0x0033,0x0330,0x0333,0x0033,0x0C03,0x0CC3,0x0333,0x0333,0x0333,0x0333,0x03F3,0x03CF,0x0333,0x0333,0x0CF3,0x0333,0x0333,0x033C,0x00CF,0x0033,0x03CC,0x0033,0x0000,
-		0x0000,0x0033,0x03FF,0x0CCF,0x0303,0x00CC,0x03CF,0x003F,0x0033,0x00CC,0x0C0F,0x0003,0x0000,0x0303,0x0000,0x03CF,0x0333,0x0033,0x0303,0x0303,0x0303,0x0303,0x0303,0x03CC,0x03CF,0x0303,0x003F,0x00FC,0x00F3,0x0FFF,0x033C,0x030C,0x0C33,0x0303,0x0303,0x0033,0x0333,0x0303,0x0303,0x0333,0x0303,0x0033,0x033F,0x03C3,0x0033,0x0CF3,0x0C33,0x0333,0x0303,0x0333,0x0333,0x0303,0x00CC,0x0333,0x0333,0x0CF3,0x03CF,0x0303,0x03CF,0x0033,0x03CF,0x00CC,0x03FF,0x0000,0x00FC,0x0303,0x0303,0x0033,0x0333,0x0303,0x0303,0x0333,0x0303,0x0033,0x033F,0x03C3,0x0033,0x0CF3,0x0C33,0x0333,0x0303,0x0333,0x0333,0x0303,0x00CC,0x0333,0x0333,0x0CF3,0x03CF,0x0303,0x03CF,0x00F3,0x0033,0x033C,0x0FFF,0x0000,
-		0x0000,0x0033,0x03FF,0x0CCF,0x0303,0x00CC,0x03CF,0x003F,0x0033,0x00CC,0x0C0F,0x0003,0x0000,0x0303,0x0000,0x03CF,0x0333,0x0033,0x0303,0x0303,0x0303,0x0303,0x0303,0x03CC,0x03CF,0x0303,0x003F,0x00FC,0x00F3,0x0FFF,0x033C,0x030C,0x0C33,0x0303,0x0303,0x0033,0x0333,0x0303,0x0303,0x0333,0x0303,0x0033,0x033F,0x03C3,0x0033,0x0CF3,0x0C33,0x0333,0x0303,0x0333,0x0333,0x0303,0x00CC,0x0333,0x0333,0x0CF3,0x03CF,0x0303,0x03CF,0x0033,0x03CF,0x00CC,0x03FF,0x0000,0x00FC,0x0303,0x0303,0x0033,0x0333,0x0303,0x0303,0x0333,0x0303,0x0033,0x033F,0x03C3,0x0033,0x0CF3,0x0C33,0x0333,0x0303,0x0333,0x0333,0x0303,0x00CC,0x0333,0x0333,0x0CF3,0x03CF,0x0303,0x03CF,0x00F3,0x0033,0x033C,0x0FFF,0x0000,
-		0x0000,0x003F,0x0000,0x0003,0x033F,0x03F3,0x0C33,0x0000,0x0033,0x00CC,0x0333,0x0F3F,0x00FC,0x03FF,0x003F,0x00F3,0x0333,0x0033,0x03F3,0x033F,0x033F,0x033F,0x0333,0x00CC,0x0333,0x033F,0x0033,0x00FC,0x03CF,0x0C03,0x03CF,0x03FC,0x0FF3,0x0333,0x0333,0x03F3,0x0333,0x03F3,0x03F3,0x0333,0x0333,0x0033,0x0333,0x0333,0x03F3,0x0CF3,0x0CF3,0x0333,0x03F3,0x0333,0x00C3,0x033F,0x00CC,0x0333,0x0333,0x0C03,0x0333,0x03CF,0x00F3,0x0033,0x033C,0x00CC,0x0000,0x0000,0x0000,0x0333,0x0333,0x03F3,0x0333,0x03F3,0x03F3,0x0333,0x0333,0x0033,0x0333,0x0333,0x03F3,0x0CF3,0x0CF3,0x0333,0x03F3,0x0333,0x00C3,0x033F,0x00CC,0x0333,0x0333,0x0C03,0x0333,0x03CF,0x00F3,0x00CF,0x0033,0x03CC,0x0000,0x0000,
-		0x0000,0x003F,0x0000,0x0003,0x033F,0x03F3,0x0C33,0x0000,0x0033,0x00CC,0x0333,0x0F3F,0x00FC,0x03FF,0x003F,0x00F3,0x0333,0x0033,0x03F3,0x033F,0x033F,0x033F,0x0333,0x00CC,0x0333,0x033F,0x0033,0x00FC,0x03CF,0x0C03,0x03CF,0x03FC,0x0FF3,0x0333,0x0333,0x03F3,0x0333,0x03F3,0x03F3,0x0333,0x0333,0x0033,0x0333,0x0333,0x03F3,0x0CF3,0x0CF3,0x0333,0x03F3,0x0333,0x00C3,0x033F,0x00CC,0x0333,0x0333,0x0C03,0x0333,0x03CF,0x00F3,0x0033,0x033C,0x00CC,0x0000,0x0000,0x0000,0x0333,0x0333,0x03F3,0x0333,0x03F3,0x03F3,0x0333,0x0333,0x0033,0x0333,0x0333,0x03F3,0x0CF3,0x0CF3,0x0333,0x03F3,0x0333,0x00C3,0x033F,0x00CC,0x0333,0x0333,0x0C03,0x0333,0x03CF,0x00F3,0x00CF,0x0033,0x03CC,0x0000,0x0000,
-		0x0000,0x0033,0x0000,0x0CCF,0x0303,0x0333,0x0303,0x0000,0x00F3,0x00CF,0x0F3F,0x0330,0x00CF,0x0000,0x0033,0x0033,0x0303,0x0033,0x0303,0x0303,0x0330,0x0303,0x0303,0x00CC,0x0303,0x0303,0x003F,0x00CF,0x033C,0x0FFF,0x00F3,0x00CC,0x0C03,0x0333,0x0303,0x0303,0x03C3,0x0303,0x0033,0x0303,0x0333,0x0033,0x0303,0x0333,0x0303,0x0CF3,0x0CF3,0x0303,0x0033,0x0303,0x0333,0x0303,0x00CC,0x0303,0x03CF,0x0CF3,0x0333,0x00CC,0x0303,0x00F3,0x0330,0x00CF,0x0000,0x0FFF,0x0000,0x0333,0x0303,0x0303,0x03C3,0x0303,0x0033,0x0303,0x0333,0x0033,0x0303,0x0333,0x0303,0x0CF3,0x0CF3,0x0303,0x0033,0x0303,0x0333,0x0303,0x00CC,0x0303,0x03CF,0x0CF3,0x0333,0x00CC,0x0303,0x03CC,0x0033,0x00CF,0x0000,0x0000,
-		0x0000,0x0033,0x0000,0x0CCF,0x0303,0x0333,0x0303,0x0000,0x00F3,0x00CF,0x0F3F,0x0330,0x00CF,0x0000,0x0033,0x0033,0x0303,0x0033,0x0303,0x0303,0x0330,0x0303,0x0303,0x00CC,0x0303,0x0303,0x003F,0x00CF,0x033C,0x0FFF,0x00F3,0x00CC,0x0C03,0x0333,0x0303,0x0303,0x03C3,0x0303,0x0033,0x0303,0x0333,0x0033,0x0303,0x0333,0x0303,0x0CF3,0x0CF3,0x0303,0x0033,0x0303,0x0333,0x0303,0x00CC,0x0303,0x03CF,0x0CF3,0x0333,0x00CC,0x0303,0x00F3,0x0330,0x00CF,0x0000,0x0FFF,0x0000,0x0333,0x0303,0x0303,0x03C3,0x0303,0x0033,0x0303,0x0333,0x0033,0x0303,0x0333,0x0303,0x0CF3,0x0CF3,0x0303,0x0033,0x0303,0x0333,0x0303,0x00CC,0x0303,0x03CF,0x0CF3,0x0333,0x00CC,0x0303,0x03CC,0x0033,0x00CF,0x0000,0x0000,
-		0x0000,0x003F,0x0000,0x0FFC,0x03CF,0x03FF,0x0FFF,0x0000,0x00CF,0x00F3,0x03F0,0x03F0,0x00F3,0x0000,0x003F,0x003F,0x03FF,0x003F,0x03FF,0x03FF,0x03F0,0x03FF,0x03FF,0x00FC,0x03FF,0x03FF,0x0000,0x00F3,0x03F0,0x0000,0x003F,0x00FC,0x0FFF,0x03FF,0x03FF,0x03FF,0x00FF,0x03FF,0x003F,0x03FF,0x03FF,0x003F,0x03FF,0x03FF,0x03FF,0x0F0F,0x0FCF,0x03FF,0x003F,0x03CF,0x03FF,0x03FF,0x00FC,0x03FF,0x00FC,0x0FFF,0x03FF,0x00FC,0x03FF,0x00C3,0x03F0,0x00C3,0x0000,0x0C03,0x0000,0x03FF,0x03FF,0x03FF,0x00FF,0x03FF,0x003F,0x03FF,0x03FF,0x003F,0x03FF,0x03FF,0x03FF,0x0F0F,0x0FCF,0x03FF,0x003F,0x03CF,0x03FF,0x03FF,0x00FC,0x03FF,0x00FC,0x0FFF,0x03FF,0x00FC,0x03FF,0x030C,0x0033,0x00C3,0x0000,0x0000,
-		0x0000,0x003F,0x0000,0x0FFC,0x03CF,0x03FF,0x0FFF,0x0000,0x00CF,0x00F3,0x03F0,0x03F0,0x00F3,0x0000,0x003F,0x003F,0x03FF,0x003F,0x03FF,0x03FF,0x03F0,0x03FF,0x03FF,0x00FC,0x03FF,0x03FF,0x0000,0x00F3,0x03F0,0x0000,0x003F,0x00FC,0x0FFF,0x03FF,0x03FF,0x03FF,0x00FF,0x03FF,0x003F,0x03FF,0x03FF,0x003F,0x03FF,0x03FF,0x03FF,0x0F0F,0x0FCF,0x03FF,0x003F,0x03CF,0x03FF,0x03FF,0x00FC,0x03FF,0x00FC,0x0FFF,0x03FF,0x00FC,0x03FF,0x00C3,0x03F0,0x00C3,0x0000,0x0C03,0x0000,0x03FF,0x03FF,0x03FF,0x00FF,0x03FF,0x003F,0x03FF,0x03FF,0x003F,0x03FF,0x03FF,0x03FF,0x0F0F,0x0FCF,0x03FF,0x003F,0x03CF,0x03FF,0x03FF,0x00FC,0x03FF,0x00FC,0x0FFF,0x03FF,0x00FC,0x03FF,0x030C,0x0033,0x00C3,0x0000,0x0000,
-		0x0000,0x0000,0x0000,0x0000,0x00FC,0x0000,0x0000,0x0000,0x00FC,0x003F,0x0000,0x0000,0x003F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x003F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x00FF,0x0000,0x00FF,0x0000,0x0FFF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x03FC,0x003F,0x00FF,0x0000,0x0000,
-		0x0000,0x0000,0x0000,0x0000,0x00FC,0x0000,0x0000,0x0000,0x00FC,0x003F,0x0000,0x0000,0x003F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x003F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x00FF,0x0000,0x00FF,0x0000,0x0FFF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x03FC,0x003F,0x00FF,0x0000,0x0000,
+// Stored at its native 6x8 size, the 7-segment look comes from drawing it
+// scaled with GLYPH_DrawString().
+static const uint8_t font6x8_segment[] = {0x00,0x07,0x1F,0x3E,0x1B,0x1F,0x1F,0x07,0x0B,0x0D,0x1C,0x1C,0x00,0x00,0x00,0x1C,0x1F,0x07,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x00,0x00,0x1C,0x00,0x07,0x1F,0x3F,0x1F,0x1F,0x1F,0x0F,0x1F,0x1F,0x1F,0x1F,0x07,0x1C,0x1F,0x07,0x3F,0x37,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x33,0x1F,0x1F,0x1F,0x09,0x07,0x09,0x0E,0x00,0x07,0x1F,0x1F,0x1F,0x0F,0x1F,0x1F,0x1F,0x1F,0x07,0x1C,0x1F,0x07,0x3F,0x37,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x33,0x1F,0x1F,0x1F,0x12,0x05,0x09,0x3F,0x00,
+		0x00,0x05,0x15,0x2B,0x11,0x15,0x11,0x05,0x0D,0x0B,0x37,0x14,0x00,0x00,0x00,0x14,0x11,0x05,0x11,0x11,0x15,0x11,0x11,0x11,0x11,0x11,0x07,0x0E,0x16,0x3F,0x0D,0x11,0x21,0x11,0x11,0x11,0x19,0x11,0x11,0x11,0x15,0x05,0x14,0x15,0x05,0x2D,0x2D,0x11,0x11,0x11,0x11,0x11,0x11,0x15,0x15,0x2D,0x15,0x15,0x11,0x0D,0x05,0x0B,0x1B,0x00,0x0D,0x11,0x11,0x11,0x19,0x11,0x11,0x11,0x15,0x05,0x14,0x15,0x05,0x2D,0x2D,0x11,0x11,0x11,0x11,0x11,0x11,0x15,0x15,0x2D,0x15,0x15,0x11,0x1A,0x05,0x0B,0x11,0x00,
+		0x00,0x05,0x15,0x01,0x1D,0x17,0x35,0x05,0x05,0x0A,0x15,0x37,0x00,0x1F,0x00,0x16,0x15,0x05,0x17,0x17,0x15,0x1D,0x1D,0x17,0x15,0x15,0x05,0x0A,0x1B,0x21,0x1B,0x17,0x2D,0x15,0x15,0x1D,0x15,0x1D,0x1D,0x1D,0x15,0x05,0x14,0x15,0x05,0x21,0x29,0x15,0x15,0x15,0x15,0x1D,0x1B,0x15,0x15,0x2D,0x15,0x15,0x16,0x05,0x0D,0x0A,0x15,0x00,0x0B,0x15,0x15,0x1D,0x15,0x1D,0x1D,0x1D,0x15,0x05,0x14,0x15,0x05,0x21,0x29,0x15,0x15,0x15,0x15,0x1D,0x1B,0x15,0x15,0x2D,0x15,0x15,0x16,0x0B,0x05,0x1A,0x05,0x00,
+		0x00,0x05,0x1F,0x2B,0x11,0x0A,0x1B,0x07,0x05,0x0A,0x23,0x01,0x00,0x11,0x00,0x1B,0x15,0x05,0x11,0x11,0x11,0x11,0x11,0x1A,0x1B,0x11,0x07,0x0E,0x0D,0x3F,0x16,0x12,0x25,0x11,0x11,0x05,0x15,0x11,0x11,0x15,0x11,0x05,0x17,0x19,0x05,0x2D,0x25,0x15,0x11,0x15,0x15,0x11,0x0A,0x15,0x15,0x2D,0x1B,0x11,0x1B,0x05,0x1B,0x0A,0x1F,0x00,0x0E,0x11,0x11,0x05,0x15,0x11,0x11,0x15,0x11,0x05,0x17,0x19,0x05,0x2D,0x25,0x15,0x11,0x15,0x15,0x11,0x0A,0x15,0x15,0x2D,0x1B,0x11,0x1B,0x0D,0x05,0x16,0x3F,0x00,
+		0x00,0x07,0x00,0x01,0x17,0x1D,0x25,0x00,0x05,0x0A,0x15,0x37,0x0E,0x1F,0x07,0x0D,0x15,0x05,0x1D,0x17,0x17,0x17,0x15,0x0A,0x15,0x17,0x05,0x0E,0x1B,0x21,0x1B,0x1E,0x3D,0x15,0x15,0x1D,0x15,0x1D,0x1D,0x15,0x15,0x05,0x15,0x15,0x1D,0x2D,0x2D,0x15,0x1D,0x15,0x09,0x17,0x0A,0x15,0x15,0x21,0x15,0x1B,0x0D,0x05,0x16,0x0A,0x00,0x00,0x00,0x15,0x15,0x1D,0x15,0x1D,0x1D,0x15,0x15,0x05,0x15,0x15,0x1D,0x2D,0x2D,0x15,0x1D,0x15,0x09,0x17,0x0A,0x15,0x15,0x21,0x15,0x1B,0x0D,0x0B,0x05,0x1A,0x00,0x00,
+		0x00,0x05,0x00,0x2B,0x11,0x15,0x11,0x00,0x0D,0x0B,0x37,0x14,0x0B,0x00,0x05,0x05,0x11,0x05,0x11,0x11,0x14,0x11,0x11,0x0A,0x11,0x11,0x07,0x0B,0x16,0x3F,0x0D,0x0A,0x21,0x15,0x11,0x11,0x19,0x11,0x05,0x11,0x15,0x05,0x11,0x15,0x11,0x2D,0x2D,0x11,0x05,0x11,0x15,0x11,0x0A,0x11,0x1B,0x2D,0x15,0x0A,0x11,0x0D,0x14,0x0B,0x00,0x3F,0x00,0x15,0x11,0x11,0x19,0x11,0x05,0x11,0x15,0x05,0x11,0x15,0x11,0x2D,0x2D,0x11,0x05,0x11,0x15,0x11,0x0A,0x11,0x1B,0x2D,0x15,0x0A,0x11,0x1A,0x05,0x0B,0x00,0x00,
+		0x00,0x07,0x00,0x3E,0x1B,0x1F,0x3F,0x00,0x0B,0x0D,0x1C,0x1C,0x0D,0x00,0x07,0x07,0x1F,0x07,0x1F,0x1F,0x1C,0x1F,0x1F,0x0E,0x1F,0x1F,0x00,0x0D,0x1C,0x00,0x07,0x0E,0x3F,0x1F,0x1F,0x1F,0x0F,0x1F,0x07,0x1F,0x1F,0x07,0x1F,0x1F,0x1F,0x33,0x3B,0x1F,0x07,0x1B,0x1F,0x1F,0x0E,0x1F,0x0E,0x3F,0x1F,0x0E,0x1F,0x09,0x1C,0x09,0x00,0x21,0x00,0x1F,0x1F,0x1F,0x0F,0x1F,0x07,0x1F,0x1F,0x07,0x1F,0x1F,0x1F,0x33,0x3B,0x1F,0x07,0x1B,0x1F,0x1F,0x0E,0x1F,0x0E,0x3F,0x1F,0x0E,0x1F,0x12,0x05,0x09,0x00,0x00,
+		0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x0E,0x07,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x0F,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x07,0x0F,0x00,0x00,
 };
-const GLIB_Font_t GLIB_font7Segment = { (void *)font4x8_segment,
-                                         sizeof(font4x8_segment),
-                                         sizeof(font4x8_segment[0]),
-                                         96, 12, 16, 2, 0, FullFont };
+const GLIB_Font_t GLIB_font7Segment = { (void *)font6x8_segment,
+                                         sizeof(font6x8_segment),
+                                         sizeof(font6x8_segment[0]),
+                                         96, 6, 8, 1, 0, FullFont };
@@ -0,0 +1,256 @@
+/*
+ * alarm.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "em_core.h"
+#include "sl_sleeptimer.h"
+#include "event_queue.h"
+#include "alarm.h"
+
+#define SECONDS_PER_DAY  86400
+#define DAYS_PER_WEEK    7
+
+static Alarm table[ALARM_MAX];
+// indices of the enabled entries, sorted by next_fire
+static uint8_t order[ALARM_MAX];
+static uint32_t armed = 0;
+// one bit per entry whose next_fire is a snooze rather than its schedule
+static uint32_t snoozed = 0;
+
+// firing second the timer runs towards
+static volatile uint32_t target;
+// whole seconds still to wait once the running timer segment expires
+static volatile uint32_t seconds_left;
+
+static sl_sleeptimer_timer_handle_t alarm_timer;
+
+static void alarm_callback(sl_sleeptimer_timer_handle_t *handle, void *data);
+
+static bool repeats(const Alarm *alarm) {
+	return alarm->type == REPEATABLE && alarm->days != 0;
+}
+
+/***************************************************************************//**
+ * @brief Returns the number of days from wday to the first day the alarm
+ *        rings on, looking no closer than first days ahead.
+ ******************************************************************************/
+static uint32_t days_to_match(const Alarm *alarm, int32_t wday,
+		uint32_t first) {
+	uint32_t k;
+
+	if (!repeats(alarm)) {
+		return first;
+	}
+
+	wday += first;
+	if (wday >= DAYS_PER_WEEK) {
+		wday -= DAYS_PER_WEEK;
+	}
+	for (k = first; k < first + DAYS_PER_WEEK; k++) {
+		if (alarm->days & ALARM_DAY(wday)) {
+			break;
+		}
+		wday = (wday == SUN) ? MON : wday + 1;
+	}
+	return k;
+}
+
+/***************************************************************************//**
+ * @brief Returns the first second after now the alarm rings at, or now itself
+ *        if include_now is set and the alarm rings this second.
+ ******************************************************************************/
+static uint32_t next_after(const Alarm *alarm, uint32_t now, const Time *t,
+		bool include_now) {
+	uint32_t second_of_day = t->tm_hour * 3600 + t->tm_min * 60 + t->tm_sec;
+	// today only counts while the alarm time is still ahead
+	bool today = alarm->time_of > second_of_day
+			|| (include_now && alarm->time_of == second_of_day);
+	uint32_t days = days_to_match(alarm, t->tm_wday, today ? 0 : 1);
+
+	return now - second_of_day + days * SECONDS_PER_DAY + alarm->time_of;
+}
+
+static void insert_order(uint32_t index) {
+	uint32_t pos = armed;
+
+	while (pos > 0
+			&& table[order[pos - 1]].next_fire > table[index].next_fire) {
+		order[pos] = order[pos - 1];
+		pos--;
+	}
+	order[pos] = index;
+	armed++;
+}
+
+static void remove_order(uint32_t index) {
+	uint32_t pos = 0;
+
+	while (pos < armed && order[pos] != index) {
+		pos++;
+	}
+	if (pos == armed) {
+		return;
+	}
+	armed--;
+	for (; pos < armed; pos++) {
+		order[pos] = order[pos + 1];
+	}
+}
+
+/***************************************************************************//**
+ * @brief Starts the one-shot timer.
+ * @param ticks
+ *        Ticks to the second boundary the wait is counted from.
+ * @param seconds
+ *        Whole seconds after that boundary. The timeout of a single timer is
+ *        limited to 32 bits of ticks, longer waits are split into segments.
+ ******************************************************************************/
+static void start_segment(uint32_t ticks, uint32_t seconds) {
+	uint32_t freq = sl_sleeptimer_get_timer_frequency();
+	uint32_t chunk = (UINT32_MAX - ticks) / freq;
+
+	if (chunk > seconds) {
+		chunk = seconds;
+	}
+	seconds_left = seconds - chunk;
+	sl_sleeptimer_restart_timer(&alarm_timer, ticks + chunk * freq,
+			alarm_callback, NULL, 0, 0);
+}
+
+static void alarm_callback(sl_sleeptimer_timer_handle_t *handle, void *data) {
+	(void) handle;
+	(void) data;
+
+	if (seconds_left > 0) {
+		start_segment(0, seconds_left);
+	} else {
+		EVENTS_Post(EVENT_ALARM, target);
+	}
+}
+
+void ALARM_Init(void) {
+	for (uint32_t i = 0; i < ALARM_MAX; i++) {
+		table[i] = (Alarm ) { 0 };
+		table[i].ring_seconds = ALARM_RING_SECONDS;
+	}
+	armed = 0;
+	snoozed = 0;
+}
+
+Alarm ALARM_Get(uint32_t index) {
+	return table[index];
+}
+
+void ALARM_Store(uint32_t index, const Alarm *alarm, uint32_t now,
+		const Time *t) {
+	remove_order(index);
+	table[index] = *alarm;
+	table[index].snoozes = 0;
+	snoozed &= ~(1u << index);
+	if (table[index].enabled) {
+		table[index].next_fire = next_after(&table[index], now, t, false);
+		insert_order(index);
+	}
+}
+
+bool ALARM_IsSet(void) {
+	return armed > 0;
+}
+
+/***************************************************************************//**
+ * @brief Checks the first alarm in the firing order against the current time.
+ * @note  The order is kept sorted on every change, so this is one comparison
+ *        no matter how many alarms are set. Call it until it returns -1 to
+ *        catch alarms sharing the same second.
+ * @return Index of the alarm that rings now, or -1.
+ ******************************************************************************/
+int32_t ALARM_Due(uint32_t now, const Time *t) {
+	uint32_t index;
+
+	if (armed == 0 || table[order[0]].next_fire > now) {
+		return -1;
+	}
+
+	index = order[0];
+	remove_order(index);
+	snoozed &= ~(1u << index);
+	if (repeats(&table[index])) {
+		table[index].next_fire = next_after(&table[index], now, t, false);
+		insert_order(index);
+	} else {
+		table[index].enabled = false;
+	}
+	return index;
+}
+
+/***************************************************************************//**
+ * @brief Rings the alarm again after ALARM_SNOOZE_SECONDS, at most
+ *        ALARM_SNOOZE_MAX times in a row.
+ ******************************************************************************/
+void ALARM_Snooze(uint32_t index, uint32_t now) {
+	if (table[index].snoozes >= ALARM_SNOOZE_MAX) {
+		ALARM_Dismiss(index);
+		return;
+	}
+	remove_order(index);
+	table[index].snoozes++;
+	table[index].enabled = true;
+	table[index].next_fire = now + ALARM_SNOOZE_SECONDS;
+	snoozed |= 1u << index;
+	insert_order(index);
+}
+
+void ALARM_Dismiss(uint32_t index) {
+	table[index].snoozes = 0;
+}
+
+/***************************************************************************//**
+ * @brief Recomputes every firing time after the time was set.
+ * @note  An alarm set for the current second keeps it, ring the due alarms
+ *        with ALARM_Due afterwards. Snoozes are counted in real seconds, so a
+ *        pending snooze moves along with the clock instead of being dropped.
+ * @param shift
+ *        Seconds the displayed time jumped by, beyond its normal advance.
+ ******************************************************************************/
+void ALARM_Rebuild(uint32_t now, const Time *t, int32_t shift) {
+	armed = 0;
+	for (uint32_t i = 0; i < ALARM_MAX; i++) {
+		if (!table[i].enabled) {
+			continue;
+		}
+		if (table[i].snoozes > 0 && (snoozed & (1u << i))) {
+			table[i].next_fire += shift;
+		} else {
+			table[i].next_fire = next_after(&table[i], now, t, true);
+		}
+		insert_order(i);
+	}
+}
+
+/***************************************************************************//**
+ * @brief Arms a one-shot timer for the first alarm in the firing order, so
+ *        nothing runs between now and then.
+ * @param now
+ *        Displayed time in seconds.
+ * @param ticksToNextSecond
+ *        Ticks until the clock tick that makes the displayed time now + 1.
+ ******************************************************************************/
+void ALARM_Arm(uint32_t now, uint32_t ticksToNextSecond) {
+	CORE_DECLARE_IRQ_STATE;
+	uint32_t next;
+
+	CORE_ENTER_ATOMIC();
+	if (armed > 0) {
+		next = table[order[0]].next_fire;
+		target = next;
+		start_segment(ticksToNextSecond, next > now ? next - now - 1 : 0);
+	} else {
+		sl_sleeptimer_stop_timer(&alarm_timer);
+	}
+	CORE_EXIT_ATOMIC();
+}
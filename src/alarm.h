@@ -0,0 +1,38 @@
+/*
+ * alarm.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+#ifndef ALARM_H
+#define ALARM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "clock_control.h"
+
+// must be a power of two, at most 32
+#define ALARM_MAX            16
+// default for Alarm.ring_seconds
+#define ALARM_RING_SECONDS   60
+#define ALARM_SNOOZE_SECONDS 300
+#define ALARM_SNOOZE_MAX     3
+
+void ALARM_Init(void);
+Alarm ALARM_Get(uint32_t index);
+// replaces a table entry and moves it to its place in the firing order
+void ALARM_Store(uint32_t index, const Alarm *alarm, uint32_t now,
+		const Time *t);
+bool ALARM_IsSet(void);
+// returns the index of an alarm due at now and reschedules it, or -1
+int32_t ALARM_Due(uint32_t now, const Time *t);
+void ALARM_Snooze(uint32_t index, uint32_t now);
+void ALARM_Dismiss(uint32_t index);
+// recomputes every firing time, needed whenever the time has been set;
+// shift is how far the time jumped, pending snoozes move along with it
+void ALARM_Rebuild(uint32_t now, const Time *t, int32_t shift);
+// arms the timer for the first alarm in the firing order
+void ALARM_Arm(uint32_t now, uint32_t ticksToNextSecond);
+
+#endif /* ALARM_H */
@@ -0,0 +1,183 @@
+/*
+ * buttons.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "em_device.h"
+#include "em_cmu.h"
+#include "em_gpio.h"
+#include "bspconfig.h"
+#include "sl_sleeptimer.h"
+#include "event_queue.h"
+#include "buttons.h"
+
+#define BUTTON_PINS ((1 << BSP_GPIO_PB0_PIN) | (1 << BSP_GPIO_PB1_PIN))
+
+// what the hold timer is waiting for
+typedef enum HoldPhase {
+	HOLD_CHORD_WINDOW,
+	HOLD_LONG_PRESS,
+	HOLD_REPEAT
+} HoldPhase;
+
+// Both timers only run while a pin bounces or a button is held, the buttons
+// cost no wakeup while they are idle.
+static sl_sleeptimer_timer_handle_t debounce_timer;
+static sl_sleeptimer_timer_handle_t hold_timer;
+
+static volatile uint32_t pressed = 0;
+// pressed, but the PRESS waits for the chord window to close
+static uint32_t pending = 0;
+// set from the chord until both buttons are up again
+static bool chord = false;
+static HoldPhase phase;
+static uint32_t repeat_ms;
+
+static void debounce_callback(sl_sleeptimer_timer_handle_t *handle, void *data);
+static void hold_callback(sl_sleeptimer_timer_handle_t *handle, void *data);
+
+static uint32_t sample_pins(void) {
+	uint32_t buttons = 0;
+
+	// pulled up, low while pressed
+	if (!GPIO_PinInGet(BSP_GPIO_PB0_PORT, BSP_GPIO_PB0_PIN)) {
+		buttons |= BUTTON_PB0;
+	}
+	if (!GPIO_PinInGet(BSP_GPIO_PB1_PORT, BSP_GPIO_PB1_PIN)) {
+		buttons |= BUTTON_PB1;
+	}
+	return buttons;
+}
+
+static void post(ButtonEventType type, uint32_t buttons) {
+	EVENTS_Post(EVENT_BUTTON, BUTTON_EVENT_DATA(type, buttons));
+}
+
+static void start_hold(HoldPhase next, uint32_t ms) {
+	phase = next;
+	sl_sleeptimer_restart_timer_ms(&hold_timer, ms, hold_callback, NULL, 0, 0);
+}
+
+static void flush_pending(void) {
+	if (pending != 0) {
+		post(BUTTON_PRESS, pending);
+		pending = 0;
+	}
+}
+
+/***************************************************************************//**
+ * @brief Runs once the pins have been stable for BUTTONS_DEBOUNCE_MS and turns
+ *        the change of the debounced levels into events.
+ ******************************************************************************/
+static void debounce_callback(sl_sleeptimer_timer_handle_t *handle, void *data) {
+	(void) handle;
+	(void) data;
+	uint32_t now = sample_pins();
+	uint32_t down = now & ~pressed;
+	uint32_t up = pressed & ~now;
+
+	pressed = now;
+
+	if (up != 0) {
+		if (chord) {
+			chord = (now != 0);
+		} else {
+			// a short press still counts once
+			flush_pending();
+			sl_sleeptimer_stop_timer(&hold_timer);
+		}
+		post(BUTTON_RELEASE, up);
+	}
+
+	if (down != 0 && !chord) {
+		if (now == BUTTON_ALL) {
+			// the first button's PRESS is dropped if it is still pending
+			chord = true;
+			pending = 0;
+			sl_sleeptimer_stop_timer(&hold_timer);
+			post(BUTTON_CHORD, BUTTON_ALL);
+		} else {
+			pending = down;
+			start_hold(HOLD_CHORD_WINDOW, BUTTONS_CHORD_MS);
+		}
+	}
+}
+
+/***************************************************************************//**
+ * @brief Steps a single held button through PRESS, LONG_PRESS and REPEAT.
+ ******************************************************************************/
+static void hold_callback(sl_sleeptimer_timer_handle_t *handle, void *data) {
+	(void) handle;
+	(void) data;
+
+	switch (phase) {
+	case HOLD_CHORD_WINDOW:
+		flush_pending();
+		start_hold(HOLD_LONG_PRESS, BUTTONS_LONG_PRESS_MS - BUTTONS_CHORD_MS);
+		break;
+	case HOLD_LONG_PRESS:
+		post(BUTTON_LONG_PRESS, pressed);
+		repeat_ms = BUTTONS_REPEAT_START_MS;
+		start_hold(HOLD_REPEAT, repeat_ms);
+		break;
+	default:
+		post(BUTTON_REPEAT, pressed);
+		repeat_ms -= repeat_ms / 4;
+		if (repeat_ms < BUTTONS_REPEAT_MIN_MS) {
+			repeat_ms = BUTTONS_REPEAT_MIN_MS;
+		}
+		start_hold(HOLD_REPEAT, repeat_ms);
+		break;
+	}
+}
+
+/***************************************************************************//**
+ * @brief Shared part of the GPIO interrupt handlers. Every edge, bounces
+ *        included, pushes the debounce timeout back.
+ ******************************************************************************/
+static void buttons_irq(void) {
+	uint32_t flags = GPIO_IntGet() & BUTTON_PINS;
+
+	if (flags != 0) {
+		GPIO_IntClear(flags);
+		sl_sleeptimer_restart_timer_ms(&debounce_timer, BUTTONS_DEBOUNCE_MS,
+				debounce_callback, NULL, 0, 0);
+	}
+}
+
+void GPIO_ODD_IRQHandler(void) {
+	buttons_irq();
+}
+
+void GPIO_EVEN_IRQHandler(void) {
+	buttons_irq();
+}
+
+void BUTTONS_Init(void) {
+	CMU_ClockEnable(cmuClock_GPIO, true);
+
+	pending = 0;
+	chord = false;
+
+	GPIO_PinModeSet(BSP_GPIO_PB0_PORT, BSP_GPIO_PB0_PIN, gpioModeInputPull, 1);
+	GPIO_PinModeSet(BSP_GPIO_PB1_PORT, BSP_GPIO_PB1_PIN, gpioModeInputPull, 1);
+	// a button held at reset only produces its RELEASE
+	pressed = sample_pins();
+
+	GPIO_IntConfig(BSP_GPIO_PB0_PORT, BSP_GPIO_PB0_PIN, true, true, true);
+	GPIO_IntConfig(BSP_GPIO_PB1_PORT, BSP_GPIO_PB1_PIN, true, true, true);
+
+	/* PB0 and PB1 sit on an odd and an even pin, both lines are needed */
+	NVIC_ClearPendingIRQ(GPIO_ODD_IRQn);
+	NVIC_EnableIRQ(GPIO_ODD_IRQn);
+	NVIC_ClearPendingIRQ(GPIO_EVEN_IRQn);
+	NVIC_EnableIRQ(GPIO_EVEN_IRQn);
+}
+
+uint32_t BUTTONS_GetPressed(void) {
+	return pressed;
+}
@@ -0,0 +1,44 @@
+/*
+ * buttons.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+#ifndef BUTTONS_H
+#define BUTTONS_H
+
+#include <stdint.h>
+
+// time the pins must be stable before a change counts
+#define BUTTONS_DEBOUNCE_MS     20
+// a second button pressed within this time makes a chord, not a press
+#define BUTTONS_CHORD_MS        60
+#define BUTTONS_LONG_PRESS_MS   600
+// the repeat interval shrinks by a quarter with every repeat
+#define BUTTONS_REPEAT_START_MS 250
+#define BUTTONS_REPEAT_MIN_MS   40
+
+// bits of the buttons mask
+#define BUTTON_PB0 0x01
+#define BUTTON_PB1 0x02
+#define BUTTON_ALL (BUTTON_PB0 | BUTTON_PB1)
+
+typedef enum ButtonEventType {
+	BUTTON_PRESS, // once per press, unless it becomes a chord
+	BUTTON_RELEASE,
+	BUTTON_LONG_PRESS, // held for BUTTONS_LONG_PRESS_MS
+	BUTTON_REPEAT, // while held after the long press, faster and faster
+	BUTTON_CHORD // both buttons pressed together
+} ButtonEventType;
+
+// Event.data of EVENT_BUTTON
+#define BUTTON_EVENT_DATA(type, buttons) (((uint32_t) (type) << 8) | (buttons))
+#define BUTTON_EVENT_TYPE(data)          ((ButtonEventType) ((data) >> 8))
+#define BUTTON_EVENT_BUTTONS(data)       ((data) & 0xFF)
+
+// configures the pins and their interrupts, needs sl_sleeptimer_init first
+void BUTTONS_Init(void);
+// debounced mask of the buttons held down
+uint32_t BUTTONS_GetPressed(void);
+
+#endif /* BUTTONS_H */
@@ -9,243 +9,209 @@
 #include <stdbool.h>
 #include <string.h>
 
-#include "em_rtc.h"
-#include "em_cmu.h"
-#include "em_emu.h"
+#include "em_device.h"
+#include "em_core.h"
+#include "sl_sleeptimer.h"
 #include "clock_control.h"
 
-#define DELAY_SECONDS 1.0
-#define LFXOFREQ      32768
-#define COMPARE_TOP   (DELAY_SECONDS * LFXOFREQ - 1)
+// Tick count at which the seconds counter was 0. Kept modulo 2^64, so the
+// time can be set to a second before the sleeptimer was started.
+static uint64_t epoch_tick = 0;
 
-static void ClockIncrement(uint32_t cnt) {
-	cnt++;
-}
-
-int32_t adjustOffset(uint32_t time, TimeType timeType, OperationType operation) {
-	volatile int32_t offsetBy = 0;
-
-	Time t = GetCurrTime(time);
-	uint32_t hr = t.tm_hour;
-
-	bool isLeap = (t.tm_year % 100 != 0 && t.tm_year % 4 == 0)
-			|| t.tm_year % 400;
-
-	if (timeType == SECOND) {
-		if (operation == INCR) {
-			if (t.tm_sec == 59) {
-				offsetBy -= 59;
-			} else {
-				offsetBy += 1;
-			}
-		} else {
-			if ((t.tm_sec == 0)) {
-				offsetBy += 59;
-			} else {
-				offsetBy -= 1;
-			}
-		}
-	}
-	if (timeType == MINUTE) {
-		if (t.tm_min == 59 && operation == INCR) {
-			offsetBy -= 59 * 60;
-		}
+// Sleeptimer frequency and its log2, set by CLOCK_Init. The LFXO runs at
+// 32768 Hz, so ticks convert to seconds with a shift; other frequencies fall
+// back to the division.
+static uint32_t freq;
+static uint32_t freq_log2;
+static bool freq_is_pow2;
 
-		if (t.tm_min == 0 && operation == DECR) {
-			offsetBy += 59 * 60;
-		}
-
-		if (!(t.tm_min == 59 && operation == INCR)
-				&& !(t.tm_min == 0 && operation == DECR)) {
-			if (operation == INCR) {
-				offsetBy += 60;
-			} else {
-				offsetBy -= 60;
-			}
-		}
-	}
+static const uint8_t days_in_month[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30,
+		31, 30, 31 };
 
-	if (timeType == HOUR) {
-		if (operation == INCR) {
-			if (hr == 23) {
-				offsetBy = offsetBy - 23 * 3600;
-			} else {
-				offsetBy += 3600;
-			}
-		} else {
-			if (t.tm_hour == 0) {
-				offsetBy += 23 * 3600;
-			} else {
-				offsetBy -= 3600;
-			}
-		}
+static uint32_t DaysInMonth(uint32_t mon, int32_t year) {
+	if (mon == 2 && (year & 3) == 0 && (year % 100 != 0 || year % 400 == 0)) {
+		return 29;
 	}
-	if (timeType == DAY) {
-		if (operation == INCR) {
-			offsetBy += 86400;
-		} else {
-			offsetBy -= 86400;
-		}
-
-		if (t.tm_mon == 2 && isLeap && t.tm_mday == 29 && operation == INCR) {
-			offsetBy -= 29 * 86400;
-		}
-
-		if (t.tm_mon == 2 && !isLeap && t.tm_mday == 28 && operation == INCR) {
-			offsetBy -= 28 * 86400;
-		}
+	return days_in_month[mon - 1];
+}
 
-		if (t.tm_mon == 2 && isLeap && t.tm_mday == 1 && operation == DECR) {
-			offsetBy -= 29 * 86400;
-		}
+/***************************************************************************//**
+ * @brief Inverse of the date part of GetCurrTime.
+ * @return Days since 1970-01-01, for years from 1970 on.
+ ******************************************************************************/
+static int32_t DaysFromCivil(int32_t year, uint32_t mon, uint32_t mday) {
+	year -= mon <= 2;
+	int32_t era = year / 400;
+	uint32_t yoe = year - era * 400;                                 // [0, 399]
+	uint32_t doy = (153 * (mon > 2 ? mon - 3 : mon + 9) + 2) / 5 + mday - 1;
+	uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;            // [0, 146096]
+
+	return era * 146097 + (int32_t) doe - 719468;
+}
 
-		if (t.tm_mon == 2 && !isLeap && t.tm_mday == 1 && operation == DECR) {
-			offsetBy -= 28 * 86400;
-		}
+/***************************************************************************//**
+ * @brief Converts seconds since 1970-01-01 to broken-down time.
+ * @note  Every division is done in software on the M0+, so the time of day is
+ *        taken from the remainder of the day instead of dividing sec again
+ *        for each field.
+ ******************************************************************************/
+Time GetCurrTime(uint32_t sec) {
+	uint32_t days = sec / 86400;
+	uint32_t rem = sec - days * 86400;                                // [0, 86399]
+	uint32_t hour = rem / 3600;
+	rem -= hour * 3600;                                               // [0, 3599]
+	uint32_t min = rem / 60;
+	uint32_t z = days + 719468;
 
-		if ((t.tm_mon == 1 || t.tm_mon == 3 || t.tm_mon == 5 || t.tm_mon == 7
-				|| t.tm_mon == 8 || t.tm_mon == 10 || t.tm_mon == 12)
-				&& t.tm_mday == 31 && operation == INCR) {
-			offsetBy -= 31 * 86400;
-		}
+	uint32_t era = z / 146097;
+	uint32_t doe = z - era * 146097;
+	uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+	int32_t year = (yoe) + era * 400;
+	uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);          // [0, 365]
+	uint32_t mp = (5 * doy + 2) / 153;                                // [0, 11]
+	uint32_t d = doy - (153 * mp + 2) / 5 + 1;                        // [1, 31]
+	uint32_t m = mp + (mp < 10 ? 3 : -9);
+	int32_t wdays = (days + THU) % 7;                                // [MON, SUN]
 
-		if ((t.tm_mon == 1 || t.tm_mon == 3 || t.tm_mon == 5 || t.tm_mon == 7
-				|| t.tm_mon == 8 || t.tm_mon == 10 || t.tm_mon == 12)
-				&& t.tm_mday == 1 && operation == DECR) {
-			offsetBy += 31 * 86400;
-		}
+	struct Time t = { rem - min * 60, min, hour, d, m, year + (m <= 2), wdays };
+	return t;
+}
 
-		if (!(t.tm_mon == 1 || t.tm_mon == 3 || t.tm_mon == 5 || t.tm_mon == 7
-				|| t.tm_mon == 8 || t.tm_mon == 10 || t.tm_mon == 12)
-				&& t.tm_mday == 30 && operation == INCR) {
-			offsetBy -= 30 * 86400;
-		}
+// Number of values of each wrapping field, indexed by TimeType. DAY depends on
+// the month and is looked up in days_in_month instead.
+static const uint8_t field_count[] = { 24, 60, 60, 0, 12 };
+
+/***************************************************************************//**
+ * @brief Steps one field of a time by one, wrapping within the field.
+ * @note  Other fields stay as they are, except that the day of the month is
+ *        clamped to the length of a changed month. Runs in constant time.
+ * @return Seconds to add to time, 0 if the result would leave the range of
+ *         the seconds counter.
+ ******************************************************************************/
+int32_t adjustOffset(uint32_t time, TimeType timeType, OperationType operation) {
+	Time t = GetCurrTime(time);
+	uint32_t *field[] = { &t.tm_hour, &t.tm_min, &t.tm_sec, &t.tm_mday,
+			&t.tm_mon };
+	int64_t result;
 
-		if (!(t.tm_mon == 1 || t.tm_mon == 3 || t.tm_mon == 5 || t.tm_mon == 7
-				|| t.tm_mon == 8 || t.tm_mon == 10 || t.tm_mon == 12)
-				&& t.tm_mday == 1 && operation == DECR) {
-			offsetBy += 30 * 86400;
-		}
-	}
+	if (timeType == YEAR) {
+		t.tm_year += (operation == INCR) ? 1 : -1;
+	} else {
+		// day and month count from 1
+		uint32_t first = (timeType == DAY || timeType == MONTH);
+		uint32_t count =
+				(timeType == DAY) ?
+						DaysInMonth(t.tm_mon, t.tm_year) :
+						field_count[timeType];
+		uint32_t value = *field[timeType] - first;
 
-	if (timeType == MONTH) {
 		if (operation == INCR) {
-			if (t.tm_mon == 12) {
-				if (isLeap) {
-					offsetBy -= 86400 * 366;
-				} else {
-					offsetBy -= 86400 * 365;
-				}
-			} else {
-				if (t.tm_mon == 1 || t.tm_mon == 3 || t.tm_mon == 5
-						|| t.tm_mon == 7 || t.tm_mon == 8 || t.tm_mon == 10) {
-					offsetBy += 86400 * 31;
-				} else {
-					if (t.tm_mon == 2) {
-						if (isLeap) {
-							offsetBy += 86400 * 29;
-						} else {
-							offsetBy += 86400 * 28;
-						}
-					} else {
-						offsetBy += 86400 * 30;
-					}
-				}
-			}
+			value = (value == count - 1) ? 0 : value + 1;
 		} else {
-			if (t.tm_mon == 1) {
-				if (isLeap) {
-					offsetBy += 86400 * 366;
-				} else {
-					offsetBy += 86400 * 365;
-				}
-			} else {
-				if (t.tm_mon == 12 || t.tm_mon == 3 || t.tm_mon == 5
-						|| t.tm_mon == 7 || t.tm_mon == 8 || t.tm_mon == 10) {
-					offsetBy -= 86400 * 31;
-				} else {
-					if (t.tm_mon == 2) {
-						if (isLeap) {
-							offsetBy -= 86400 * 29;
-						} else {
-							offsetBy -= 86400 * 28;
-						}
-					} else {
-						offsetBy -= 86400 * 30;
-					}
-				}
-			}
+			value = (value == 0) ? count - 1 : value - 1;
 		}
+		*field[timeType] = value + first;
 	}
 
-	if (timeType == YEAR) {
-		if (operation == INCR) {
-			if (isLeap) {
-				offsetBy += 365*86400;
-			} else {
-				offsetBy += 364*86400;
-			}
-		} else {
-			if (t.tm_year == 1970) {
-				return 0;
-			}
-
-			if (isLeap) {
-				offsetBy -= 365*86400;
-			} else {
-				offsetBy -= 364*86400;
-			}
-		}
+	if (t.tm_mday > DaysInMonth(t.tm_mon, t.tm_year)) {
+		t.tm_mday = DaysInMonth(t.tm_mon, t.tm_year);
 	}
 
-	if (offsetBy + time >= 0) {
-		return offsetBy;
-	} else {
+	result = (int64_t) DaysFromCivil(t.tm_year, t.tm_mon, t.tm_mday) * 86400
+			+ t.tm_hour * 3600 + t.tm_min * 60 + t.tm_sec;
+	if (result < 0 || result > UINT32_MAX) {
 		return 0;
 	}
-
+	return (int32_t) (result - time);
 }
 
-Time GetCurrTime(uint32_t sec) {
-	uint32_t z = (sec / 86400) + 719468;
-
-	uint32_t era = z / 146097;
-	uint32_t doe = z - era * 146097;
-	uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
-	int32_t year = (yoe) + era * 400;
-	uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);          // [0, 365]
-	uint32_t mp = (5 * doy + 2) / 153;                                // [0, 11]
-	uint32_t d = doy - (153 * mp + 2) / 5 + 1;                        // [1, 31]
-	uint32_t m = mp + (mp < 10 ? 3 : -9);
-	int32_t wdays = (z >= -4 ? (z + 4) % 7 : (z + 5) % 7 + 6);
-
-	struct Time t = { sec % 60, (sec / 60) % 60, (sec / 3600) % 24, d, m, year
-			+ (m <= 2), wdays };
-	return t;
+void CalendarSet(Calendar *cal, uint32_t sec) {
+	cal->sec = sec;
+	cal->time = GetCurrTime(sec);
 }
 
-void RTC_Setup(void) {
-	// Enable the oscillator for the RTC
-	CMU_OscillatorEnable(cmuOsc_LFXO, true, true);
+/***************************************************************************//**
+ * @brief Moves the calendar one second forward.
+ * @note  Carries propagate from seconds up to the year and stop at the first
+ *        field that does not overflow. Gives the same result as
+ *        GetCurrTime(cal->sec) but without the divisions, which the M0+ has
+ *        to do in software.
+ ******************************************************************************/
+void CalendarTick(Calendar *cal) {
+	Time *t = &cal->time;
 
-	// Turn on the clock for Low Energy clocks
-	CMU_ClockEnable(cmuClock_HFLE, true);
-	CMU_ClockSelectSet(cmuClock_LFA, cmuSelect_LFXO);
+	cal->sec++;
 
-	// Turn on the RTC clock
-	CMU_ClockEnable(cmuClock_RTC, true);
-
-	// Set RTC compare value for RTC 0
-	RTC_CompareSet(0, COMPARE_TOP);
+	if (++t->tm_sec < 60) {
+		return;
+	}
+	t->tm_sec = 0;
+	if (++t->tm_min < 60) {
+		return;
+	}
+	t->tm_min = 0;
+	if (++t->tm_hour < 24) {
+		return;
+	}
+	t->tm_hour = 0;
+	t->tm_wday = (t->tm_wday == 6) ? 0 : t->tm_wday + 1;
+	if (++t->tm_mday <= DaysInMonth(t->tm_mon, t->tm_year)) {
+		return;
+	}
+	t->tm_mday = 1;
+	if (++t->tm_mon <= 12) {
+		return;
+	}
+	t->tm_mon = 1;
+	t->tm_year++;
+}
 
-	// Allow channel 0 to cause an interrupt
-	RTC_IntEnable(RTC_IEN_COMP0);
-	NVIC_ClearPendingIRQ(RTC_IRQn);
-	NVIC_EnableIRQ(RTC_IRQn);
+void CLOCK_Init(void) {
+	freq = sl_sleeptimer_get_timer_frequency();
+	freq_log2 = 31 - __CLZ(freq);
+	freq_is_pow2 = (freq & (freq - 1)) == 0;
+}
 
-	// Configure the RTC settings
-	RTC_Init_TypeDef rtc = RTC_INIT_DEFAULT;
+/***************************************************************************//**
+ * @brief Reads the seconds counter from the sleeptimer tick count.
+ * @param ticksToNextSecond
+ *        Set to the ticks left until the counter moves on, in [1, frequency].
+ *        Can be NULL.
+ * @return Seconds since 1970-01-01.
+ ******************************************************************************/
+uint32_t CLOCK_Get(uint32_t *ticksToNextSecond) {
+	CORE_DECLARE_IRQ_STATE;
+	uint64_t ticks;
+	uint32_t sec;
+	uint32_t rest;
+
+	CORE_ENTER_ATOMIC();
+	ticks = sl_sleeptimer_get_tick_count64() - epoch_tick;
+	CORE_EXIT_ATOMIC();
+
+	if (freq_is_pow2) {
+		sec = (uint32_t) (ticks >> freq_log2);
+		rest = (uint32_t) ticks & (freq - 1);
+	} else {
+		sec = (uint32_t) (ticks / freq);
+		rest = (uint32_t) (ticks - (uint64_t) sec * freq);
+	}
+	if (ticksToNextSecond != NULL) {
+		*ticksToNextSecond = freq - rest;
+	}
+	return sec;
+}
 
-	// Initialise RTC with pre-defined settings
-	RTC_Init(&rtc);
+/***************************************************************************//**
+ * @brief Sets the seconds counter, the next second starts one full second
+ *        from now.
+ ******************************************************************************/
+void CLOCK_Set(uint32_t sec) {
+	CORE_DECLARE_IRQ_STATE;
+	uint64_t ticks = freq_is_pow2 ?
+			(uint64_t) sec << freq_log2 : (uint64_t) sec * freq;
+
+	CORE_ENTER_ATOMIC();
+	epoch_tick = sl_sleeptimer_get_tick_count64() - ticks;
+	CORE_EXIT_ATOMIC();
 }
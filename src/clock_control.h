@@ -50,15 +50,38 @@ typedef struct Time {
 	int32_t tm_wday;
 } Time;
 
+// bit of a Day in Alarm.days
+#define ALARM_DAY(day) (1 << (day))
+
 typedef struct Alarm {
-	AlarmType type;
-	Day day_repeat;
 	//represents max of 24 hours
 	uint32_t time_of;
+	// displayed time (in seconds) of the next ring, maintained by alarm.c
+	uint32_t next_fire;
+	uint8_t type; // AlarmType
+	uint8_t days; // ALARM_DAY mask for REPEATABLE alarms
+	uint8_t enabled;
+	uint8_t snoozes; // snoozes since it last rang on schedule
+	uint8_t ring_seconds;
 } Alarm;
 
-void RTC_Setup(void);
+// Broken-down time kept in step with a seconds counter, so the 1 Hz tick only
+// has to carry into the next field instead of converting the whole date.
+typedef struct Calendar {
+	uint32_t sec;
+	Time time;
+} Calendar;
+
+// seconds counter derived from the sleeptimer tick count, no 1 Hz interrupt;
+// CLOCK_Init caches the tick frequency, needs sl_sleeptimer_init first
+void CLOCK_Init(void);
+uint32_t CLOCK_Get(uint32_t *ticksToNextSecond);
+void CLOCK_Set(uint32_t sec);
 Time GetCurrTime(uint32_t sec);
+// full conversion, only needed after the time has been set
+void CalendarSet(Calendar *cal, uint32_t sec);
+// advances by one second without any division
+void CalendarTick(Calendar *cal);
 // with looping
 int32_t adjustOffset(uint32_t time, TimeType timeType, OperationType operation);
 
@@ -0,0 +1,144 @@
+/*
+ * event_queue.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "em_core.h"
+#include "em_emu.h"
+#include "sl_sleeptimer.h"
+#include "sl_sleeptimer_deferred.h"
+#include "event_queue.h"
+
+#define SECONDS_PER_HOUR 3600
+
+static Event queue[EVENT_QUEUE_SIZE];
+static volatile uint32_t head = 0;
+static volatile uint32_t tail = 0;
+static volatile uint32_t dropped = 0;
+// peripherals that need their clock while the core sleeps
+static volatile uint32_t em2_blocks = 0;
+
+// wakeup statistics, counted over one hour windows
+static uint32_t wakeups = 0;
+static uint32_t wakeups_last_hour = 0;
+static bool hour_completed = false;
+static uint64_t window_start = 0;
+
+void EVENTS_Init(void) {
+	CORE_DECLARE_IRQ_STATE;
+
+	CORE_ENTER_ATOMIC();
+	head = 0;
+	tail = 0;
+	dropped = 0;
+	CORE_EXIT_ATOMIC();
+
+	wakeups = 0;
+	wakeups_last_hour = 0;
+	hour_completed = false;
+	window_start = sl_sleeptimer_get_tick_count64();
+}
+
+/***************************************************************************//**
+ * @brief Appends an event to the queue.
+ * @return false if the queue was full and the event was dropped.
+ ******************************************************************************/
+bool EVENTS_Post(EventType type, uint32_t data) {
+	CORE_DECLARE_IRQ_STATE;
+	bool posted = false;
+
+	CORE_ENTER_ATOMIC();
+	if (head - tail < EVENT_QUEUE_SIZE) {
+		queue[head % EVENT_QUEUE_SIZE] = (Event ) { type, data };
+		head++;
+		posted = true;
+	} else {
+		dropped++;
+	}
+	CORE_EXIT_ATOMIC();
+
+	return posted;
+}
+
+/***************************************************************************//**
+ * @brief Removes the oldest event from the queue.
+ * @return false if the queue was empty.
+ ******************************************************************************/
+bool EVENTS_Pop(Event *event) {
+	CORE_DECLARE_IRQ_STATE;
+	bool popped = false;
+
+	CORE_ENTER_ATOMIC();
+	if (head != tail) {
+		*event = queue[tail % EVENT_QUEUE_SIZE];
+		tail++;
+		popped = true;
+	}
+	CORE_EXIT_ATOMIC();
+
+	return popped;
+}
+
+static void count_wakeup(void) {
+	uint64_t now = sl_sleeptimer_get_tick_count64();
+	uint64_t hour = (uint64_t) sl_sleeptimer_get_timer_frequency()
+			* SECONDS_PER_HOUR;
+
+	wakeups++;
+	if (now - window_start >= hour) {
+		wakeups_last_hour = wakeups;
+		hour_completed = true;
+		wakeups = 0;
+		window_start = now;
+	}
+}
+
+/***************************************************************************//**
+ * @brief Sleeps in EM2 until an interrupt has queued an event or a deferred
+ *        sleeptimer callback, only in EM1 while EVENTS_BlockEM2() is in
+ *        effect.
+ * @note  The queues are checked with interrupts masked so that an event
+ *        posted right before the WFI still wakes the core. Wakeups that did
+ *        not produce either (e.g. the memory LCD VCOM timer) go back to sleep.
+ ******************************************************************************/
+void EVENTS_WaitForEvent(void) {
+	CORE_DECLARE_IRQ_STATE;
+
+	CORE_ENTER_CRITICAL();
+	while (head == tail && !sl_sleeptimer_has_deferred_callbacks()) {
+		if (em2_blocks != 0) {
+			EMU_EnterEM1();
+		} else {
+			EMU_EnterEM2(true);
+		}
+		// let the pending interrupt run before checking the queue again
+		CORE_EXIT_CRITICAL();
+		count_wakeup();
+		CORE_ENTER_CRITICAL();
+	}
+	CORE_EXIT_CRITICAL();
+}
+
+void EVENTS_BlockEM2(void) {
+	CORE_ATOMIC_SECTION(em2_blocks++;)
+}
+
+void EVENTS_UnblockEM2(void) {
+	CORE_ATOMIC_SECTION(em2_blocks--;)
+}
+
+/***************************************************************************//**
+ * @brief Returns the number of EM2 wakeups during the last full hour, or the
+ *        running count if the first hour has not elapsed yet.
+ ******************************************************************************/
+uint32_t EVENTS_GetWakeupsPerHour(void) {
+	return hour_completed ? wakeups_last_hour : wakeups;
+}
+
+uint32_t EVENTS_GetDroppedCount(void) {
+	return dropped;
+}
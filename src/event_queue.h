@@ -0,0 +1,42 @@
+/*
+ * event_queue.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// must be a power of two
+#define EVENT_QUEUE_SIZE 16
+
+typedef enum EventType {
+	EVENT_TICK, // 1 Hz clock tick
+	EVENT_MEASURE, // periodic sensor measurement is due
+	EVENT_BUTTON, // debounced button event, data as built by BUTTON_EVENT_DATA
+	EVENT_ADC_DONE, // ADC conversion finished
+	EVENT_ALARM, // alarm timer expired, data holds the firing second
+	EVENT_SAMPLE // sensor measurement read, data holds its second
+} EventType;
+
+typedef struct Event {
+	EventType type;
+	uint32_t data;
+} Event;
+
+void EVENTS_Init(void);
+// safe to call from interrupt context
+bool EVENTS_Post(EventType type, uint32_t data);
+bool EVENTS_Pop(Event *event);
+// enters EM2 until at least one event is queued, EM1 while EM2 is blocked
+void EVENTS_WaitForEvent(void);
+// nestable, safe to call from interrupt context
+void EVENTS_BlockEM2(void);
+void EVENTS_UnblockEM2(void);
+uint32_t EVENTS_GetWakeupsPerHour(void);
+uint32_t EVENTS_GetDroppedCount(void);
+
+#endif /* EVENT_QUEUE_H */
@@ -0,0 +1,159 @@
+/*
+ * format.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+
+#include "clock_control.h"
+#include "format.h"
+
+#define MILLI_MAX 99999
+
+static const char digit_pairs[200] = "0001020304050607080910111213141516171819"
+		"2021222324252627282930313233343536373839"
+		"4041424344454647484950515253545556575859"
+		"6061626364656667686970717273747576777879"
+		"8081828384858687888990919293949596979899";
+
+static const char month[12][4] = { "JAN", "FEB", "MAR", "APR", "MAY", "JUN",
+		"JUL", "AUG", "SEP", "OCT", "NOV", "DEC" };
+
+static const char day_letters[7] = { 'M', 'T', 'W', 'T', 'F', 'S', 'S' };
+
+/***************************************************************************//**
+ * @brief Absolute value of milli, saturated at MILLI_MAX.
+ ******************************************************************************/
+static uint32_t milli_abs(int32_t milli) {
+	uint32_t value = (milli < 0) ? 0u - (uint32_t) milli : (uint32_t) milli;
+
+	return (value > MILLI_MAX) ? MILLI_MAX : value;
+}
+
+char *FORMAT_TwoDigits(char *dst, uint32_t value) {
+	dst[0] = digit_pairs[2 * value];
+	dst[1] = digit_pairs[2 * value + 1];
+	dst[2] = '\0';
+	return dst + 2;
+}
+
+/***************************************************************************//**
+ * @brief value / 100 as a multiplication by the reciprocal. The 32-bit one
+ *        is exact below 174796; larger values, which the pages do not draw,
+ *        take the 64-bit one, exact for any uint32_t.
+ ******************************************************************************/
+static uint32_t div100(uint32_t value) {
+	if (value < (1u << 17)) {
+		return ((value >> 2) * 5243) >> 17;
+	}
+	return (uint32_t) (((uint64_t) value * 1374389535u) >> 37);
+}
+
+/***************************************************************************//**
+ * @brief Writes value in decimal.
+ * @note  The digits are produced two at a time from the lowest, into a
+ *        buffer that is then copied behind the sign.
+ ******************************************************************************/
+char *FORMAT_Int(char *dst, int32_t value) {
+	uint32_t rest = (value < 0) ? 0u - (uint32_t) value : (uint32_t) value;
+	char digits[10];
+	char *p = digits + sizeof(digits);
+
+	while (rest >= 100) {
+		uint32_t quotient = div100(rest);
+		uint32_t pair = rest - quotient * 100;
+
+		p -= 2;
+		p[0] = digit_pairs[2 * pair];
+		p[1] = digit_pairs[2 * pair + 1];
+		rest = quotient;
+	}
+	if (rest >= 10) {
+		p -= 2;
+		p[0] = digit_pairs[2 * rest];
+		p[1] = digit_pairs[2 * rest + 1];
+	} else {
+		*--p = '0' + rest;
+	}
+
+	if (value < 0) {
+		*dst++ = '-';
+	}
+	while (p < digits + sizeof(digits)) {
+		*dst++ = *p++;
+	}
+	*dst = '\0';
+	return dst;
+}
+
+/***************************************************************************//**
+ * @brief Writes milli-units with one decimal, 5 characters wide.
+ * @note  The divisions by 100 and 10 are done as multiplications by their
+ *        reciprocals, exact over the whole range.
+ ******************************************************************************/
+char *FORMAT_Milli1(char *dst, int32_t milli) {
+	uint32_t value = milli_abs(milli);
+	uint32_t tenths = ((value >> 2) * 5243) >> 17; // value / 100
+	uint32_t whole = (tenths * 205) >> 11; // tenths / 10
+
+	dst[0] = (milli < 0) ? '-' : ' ';
+	FORMAT_TwoDigits(dst + 1, whole);
+	if (dst[1] == '0') {
+		dst[1] = ' ';
+	}
+	dst[3] = '.';
+	dst[4] = '0' + (tenths - whole * 10);
+	dst[5] = '\0';
+	return dst + 5;
+}
+
+/***************************************************************************//**
+ * @brief Writes milli-units with two decimals.
+ ******************************************************************************/
+char *FORMAT_Milli2(char *dst, int32_t milli) {
+	uint32_t value = milli_abs(milli);
+	uint32_t hundredths = ((value >> 1) * 52429) >> 18; // value / 10
+	uint32_t whole = (hundredths * 5243) >> 19; // hundredths / 100
+
+	if (milli < 0) {
+		*dst++ = '-';
+	}
+	dst = FORMAT_TwoDigits(dst, whole);
+	*dst++ = '.';
+	return FORMAT_TwoDigits(dst, hundredths - whole * 100);
+}
+
+char *FORMAT_Time(char *dst, const Time *t) {
+	dst = FORMAT_TwoDigits(dst, t->tm_hour);
+	*dst++ = ':';
+	dst = FORMAT_TwoDigits(dst, t->tm_min);
+	*dst++ = ':';
+	return FORMAT_TwoDigits(dst, t->tm_sec);
+}
+
+char *FORMAT_Date(char *dst, const Time *t) {
+	dst = FORMAT_TwoDigits(dst, t->tm_mday);
+	*dst++ = '/';
+	dst = FORMAT_TwoDigits(dst, t->tm_mon);
+	*dst++ = '/';
+	return FORMAT_Int(dst, t->tm_year);
+}
+
+char *FORMAT_Month(char *dst, uint32_t mon) {
+	return FORMAT_String(dst, month[mon - 1]);
+}
+
+char *FORMAT_DayLetter(char *dst, Day day) {
+	dst[0] = day_letters[day];
+	dst[1] = '\0';
+	return dst + 1;
+}
+
+char *FORMAT_String(char *dst, const char *s) {
+	while (*s != '\0') {
+		*dst++ = *s++;
+	}
+	*dst = '\0';
+	return dst;
+}
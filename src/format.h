@@ -0,0 +1,36 @@
+/*
+ * format.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+#ifndef FORMAT_H
+#define FORMAT_H
+
+#include <stdint.h>
+
+#include "clock_control.h"
+
+// Each function writes a NUL terminated string to dst and returns a pointer
+// to the terminator, so calls can be chained. None of them divides, which the
+// M0+ would have to do in software.
+
+// 0..99, zero padded to two digits
+char *FORMAT_TwoDigits(char *dst, uint32_t value);
+// any int32_t, up to 11 characters
+char *FORMAT_Int(char *dst, int32_t value);
+// milli-units as " dd.d": sign or space, tens or space, saturates at 99.9
+char *FORMAT_Milli1(char *dst, int32_t milli);
+// milli-units as "dd.dd", '-' in front if negative, saturates at 99.99
+char *FORMAT_Milli2(char *dst, int32_t milli);
+// "hh:mm:ss"
+char *FORMAT_Time(char *dst, const Time *t);
+// "dd/mm/yyyy"
+char *FORMAT_Date(char *dst, const Time *t);
+// "JAN" for 1
+char *FORMAT_Month(char *dst, uint32_t mon);
+// "M" for MON
+char *FORMAT_DayLetter(char *dst, Day day);
+char *FORMAT_String(char *dst, const char *s);
+
+#endif /* FORMAT_H */
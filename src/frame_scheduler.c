@@ -0,0 +1,60 @@
+/*
+ * frame_scheduler.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "em_core.h"
+#include "frame_scheduler.h"
+
+static volatile uint32_t dirty = FRAME_INPUT_ALL;
+static int32_t last_page = -1;
+static FrameStats stats;
+
+/***************************************************************************//**
+ * @brief Marks the given inputs as changed. Safe to call from interrupts.
+ ******************************************************************************/
+void FRAME_Invalidate(uint32_t inputs) {
+	CORE_DECLARE_IRQ_STATE;
+
+	CORE_ENTER_ATOMIC();
+	dirty |= inputs;
+	CORE_EXIT_ATOMIC();
+}
+
+/***************************************************************************//**
+ * @brief Decides whether the current page needs a new frame.
+ * @param page
+ *        Page that is about to be shown.
+ * @param dependsOn
+ *        FRAME_INPUT_* mask of the inputs the page renders.
+ * @return true if the caller must render (and flush) exactly one frame.
+ ******************************************************************************/
+bool FRAME_Begin(int32_t page, uint32_t dependsOn) {
+	CORE_DECLARE_IRQ_STATE;
+	bool render;
+
+	CORE_ENTER_ATOMIC();
+	render = page != last_page || (dirty & dependsOn) != 0;
+	if (render) {
+		// everything is redrawn from scratch, so all inputs are consumed
+		dirty = 0;
+	}
+	CORE_EXIT_ATOMIC();
+
+	last_page = page;
+	if (render) {
+		stats.rendered++;
+	} else {
+		stats.skipped++;
+	}
+
+	return render;
+}
+
+FrameStats FRAME_GetStats(void) {
+	return stats;
+}
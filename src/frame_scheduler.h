@@ -0,0 +1,32 @@
+/*
+ * frame_scheduler.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Inputs a page can depend on. A page is redrawn only when one of its
+// inputs has been invalidated or the visible page has changed.
+#define FRAME_INPUT_SECOND  0x01 // displayed second changed
+#define FRAME_INPUT_SENSOR  0x02 // new temperature/humidity sample
+#define FRAME_INPUT_CURSOR  0x04 // menu cursor, edited field or page state
+#define FRAME_INPUT_BLINK   0x08 // blink phase of the edited field flipped
+#define FRAME_INPUT_BATTERY 0x10 // low battery state changed
+#define FRAME_INPUT_ALL     0x1F
+
+typedef struct FrameStats {
+	uint32_t rendered;
+	uint32_t skipped;
+} FrameStats;
+
+void FRAME_Invalidate(uint32_t inputs);
+// returns true when the page has to be drawn now, consumes the dirty state
+bool FRAME_Begin(int32_t page, uint32_t dependsOn);
+FrameStats FRAME_GetStats(void);
+
+#endif /* FRAME_SCHEDULER_H */
@@ -0,0 +1,198 @@
+/*
+ * glyph.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "em_types.h"
+#include "glib.h"
+#include "lcd_flush.h"
+#include "glyph.h"
+
+// widest scaled glyph the frame buffer path handles, so that a row shifted
+// by up to 7 bits still fits 32 bits
+#define GLYPH_FAST_WIDTH_MAX 25
+
+/***************************************************************************//**
+ * @brief Reads one pixel row of a glyph, bit 0 is the leftmost pixel.
+ * @param index
+ *        Element index in the pixel map. Rows of the same glyph are
+ *        fontRowOffset elements apart.
+ ******************************************************************************/
+static uint32_t glyph_row(const GLIB_Font_t *font, uint32_t index) {
+	switch (font->sizeOfMapElement) {
+	case 1:
+		return ((const uint8_t *) font->pFontPixMap)[index];
+	case 2:
+		return ((const uint16_t *) font->pFontPixMap)[index];
+	default:
+		return ((const uint32_t *) font->pFontPixMap)[index];
+	}
+}
+
+/***************************************************************************//**
+ * @brief Draws one glyph as runs of equal pixels, each run a single
+ *        rectangle of scale rows.
+ ******************************************************************************/
+static void draw_glyph(GLIB_Context_t *pContext, uint32_t index, int32_t x,
+		int32_t y, uint32_t scale, bool opaque, uint32_t foreground) {
+	const GLIB_Font_t *font = &pContext->font;
+	GLIB_Rectangle_t run;
+
+	for (uint32_t row = 0; row < font->fontHeight; row++) {
+		uint32_t bits = glyph_row(font, index + row * font->fontRowOffset);
+		uint32_t col = 0;
+
+		run.yMin = y + row * scale;
+		run.yMax = run.yMin + scale - 1;
+
+		while (col < font->fontWidth) {
+			uint32_t on = (bits >> col) & 1;
+			uint32_t end = col + 1;
+
+			while (end < font->fontWidth && ((bits >> end) & 1) == on) {
+				end++;
+			}
+			if (on || opaque) {
+				run.xMin = x + col * scale;
+				run.xMax = x + end * scale - 1;
+				pContext->foregroundColor =
+						on ? foreground : pContext->backgroundColor;
+				GLIB_drawRectFilled(pContext, &run);
+			}
+			col = end;
+		}
+	}
+}
+
+/***************************************************************************//**
+ * @brief Widens every one of the lowest width bits to scale bits.
+ ******************************************************************************/
+static uint32_t scale_bits(uint32_t bits, uint32_t width, uint32_t scale) {
+	uint32_t block = (1u << scale) - 1;
+	uint32_t wide = 0;
+
+	if (scale == 1) {
+		return bits & ((1u << width) - 1);
+	}
+	for (uint32_t col = 0; col < width; col++) {
+		if ((bits >> col) & 1) {
+			wide |= block << (col * scale);
+		}
+	}
+	return wide;
+}
+
+/***************************************************************************//**
+ * @brief Checks that a glyph cell lies inside both the clipping region and
+ *        the frame buffer.
+ ******************************************************************************/
+static bool cell_visible(const GLIB_Context_t *pContext, int32_t x, int32_t y,
+		int32_t width, int32_t height) {
+	const GLIB_Rectangle_t *clip = &pContext->clippingRegion;
+
+	return x >= 0 && y >= 0 && x + width <= LCD_WIDTH
+			&& y + height <= LCD_HEIGHT && x >= clip->xMin
+			&& y >= clip->yMin && x + width - 1 <= clip->xMax
+			&& y + height - 1 <= clip->yMax;
+}
+
+/***************************************************************************//**
+ * @brief Writes one glyph straight into the frame buffer, a whole byte at a
+ *        time.
+ * @note  The frame buffer holds 1 bit per pixel with the leftmost pixel in
+ *        bit 0, set for any colour but black. Each glyph row is widened once
+ *        and written to scale lines. At an x that is a multiple of 8 the row
+ *        is not shifted and only the bytes of the cell are touched.
+ ******************************************************************************/
+static void blit_glyph(uint8_t *frame, const GLIB_Context_t *pContext,
+		uint32_t index, int32_t x, int32_t y, uint32_t scale, bool opaque,
+		uint32_t foreground) {
+	const GLIB_Font_t *font = &pContext->font;
+	uint32_t width = font->fontWidth * scale;
+	uint32_t shift = x & 7;
+	uint32_t cell = ((1u << width) - 1) << shift;
+	uint32_t bytes = (shift + width + 7) >> 3;
+	bool fgSet = (foreground != Black);
+	bool bgSet = (pContext->backgroundColor != Black);
+	uint8_t *line = frame + y * LCD_ROW_BYTES + (x >> 3);
+
+	for (uint32_t row = 0; row < font->fontHeight; row++) {
+		uint32_t on = scale_bits(
+				glyph_row(font, index + row * font->fontRowOffset),
+				font->fontWidth, scale) << shift;
+		uint32_t set = fgSet ? on : 0;
+		uint32_t touched = on;
+
+		if (opaque) {
+			set |= bgSet ? (cell & ~on) : 0;
+			touched = cell;
+		}
+		for (uint32_t i = 0; i < scale; i++, line += LCD_ROW_BYTES) {
+			for (uint32_t b = 0; b < bytes; b++) {
+				uint8_t mask = touched >> (8 * b);
+
+				line[b] = (line[b] & ~mask) | ((set >> (8 * b)) & mask);
+			}
+		}
+	}
+}
+
+/***************************************************************************//**
+ * @brief Draws a string with the context font scaled by an integer factor.
+ * @param scale
+ *        1 to GLYPH_SCALE_MAX.
+ * @note  Glyphs that lie fully inside the clipping region are written to the
+ *        frame buffer directly when LCD_GetFrame() provides one, the rest
+ *        through GLIB. Characters the font does not have are left blank.
+ ******************************************************************************/
+EMSTATUS GLYPH_DrawString(GLIB_Context_t *pContext, const char *s,
+		uint32_t len, int32_t x0, int32_t y0, uint32_t scale, bool opaque) {
+	const GLIB_Font_t *font = &pContext->font;
+	uint32_t foreground = pContext->foregroundColor;
+	uint8_t *frame = LCD_GetFrame();
+	int32_t cellWidth = font->fontWidth * scale;
+	int32_t cellHeight = font->fontHeight * scale;
+	int32_t x = x0;
+	int32_t y = y0;
+
+	if (font->class != FullFont) {
+		// the glyph index is not the character code
+		if (scale != 1) {
+			return GLIB_ERROR_INVALID_ARGUMENT;
+		}
+		return GLIB_drawString(pContext, s, len, x0, y0, opaque);
+	}
+	if (scale < 1 || scale > GLYPH_SCALE_MAX) {
+		return GLIB_ERROR_INVALID_ARGUMENT;
+	}
+	if (cellWidth > GLYPH_FAST_WIDTH_MAX) {
+		frame = NULL;
+	}
+
+	for (uint32_t i = 0; i < len && s[i] != '\0'; i++) {
+		uint32_t index = (uint8_t) (s[i] - ' ');
+
+		if (s[i] == '\n') {
+			x = x0;
+			y += (font->fontHeight + font->lineSpacing) * scale;
+			continue;
+		}
+		if (index < font->fontRowOffset) {
+			if (frame != NULL
+					&& cell_visible(pContext, x, y, cellWidth, cellHeight)) {
+				blit_glyph(frame, pContext, index, x, y, scale, opaque,
+						foreground);
+			} else {
+				draw_glyph(pContext, index, x, y, scale, opaque, foreground);
+			}
+		}
+		x += (font->fontWidth + font->charSpacing) * scale;
+	}
+
+	pContext->foregroundColor = foreground;
+	return GLIB_OK;
+}
@@ -0,0 +1,24 @@
+/*
+ * glyph.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+#ifndef GLYPH_H
+#define GLYPH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "em_types.h"
+#include "glib.h"
+
+#define GLYPH_SCALE_MAX 4
+
+// Draws s like GLIB_drawString, with every pixel of the context font drawn as
+// a scale x scale block. Spacing is scaled too. Stops at len characters or
+// the NUL. Fonts other than FullFont are only drawn at scale 1, by GLIB.
+EMSTATUS GLYPH_DrawString(GLIB_Context_t *pContext, const char *s,
+		uint32_t len, int32_t x0, int32_t y0, uint32_t scale, bool opaque);
+
+#endif /* GLYPH_H */
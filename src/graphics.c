@@ -20,23 +20,80 @@
 #include "glib.h"
 #include "dmd.h"
 #include "display.h"
-#include "textdisplay.h"
-#include "retargettextdisplay.h"
 #include "clock_control.h"
 #include "extra_fonts.h"
+#include "lcd_flush.h"
+#include "format.h"
+#include "glyph.h"
 #include <string.h>
-#include <stdio.h>
 
 static GLIB_Context_t glibContext; /* Global glib context */
+/* Scale the context font is drawn at by draw_string() */
+static uint32_t fontScale = 1;
 
-static const char month[12][4] = { "JAN", "FEB", "MAR", "APR", "MAY", "JUN",
-		"JUL", "AUG", "SEP", "OCT", "NOV", "DEC" };
-
-static const char days[9][4] = { "MON", "TUE", "WED", "THU", "FRI", "SAT",
-		"SUN", "WKD", "WND" };
+/* The 7-segment font is stored at 6x8 and drawn at 12x16 */
+static const uint32_t SEGMENT_FONT_SCALE = 2;
 
 static const int8_t MAX_ITEMS_IN_MENU = 5;
 
+// in the order of the menu entries
+static const char *const menu_labels[] = { "Clock", "Weather", "Clk Conf",
+		"Wth Conf", "Alarm", "Exit" };
+
+#define MENU_LABEL_COUNT ((int8_t) (sizeof(menu_labels) / sizeof(menu_labels[0])))
+
+/* Fraction bits of PixelScale.factor */
+#define PIXEL_SCALE_Q         24
+/* Ranges from here on are halved until they are below it */
+#define PIXEL_SCALE_RANGE_MAX 4096
+
+/* Linear map of the values 0..range onto 0..span pixels, see pixel_scale() */
+typedef struct PixelScale {
+	uint32_t factor; // span / range in Q24, rounded up
+	uint32_t shift; // applied to values before the factor
+} PixelScale;
+
+/* Rows of a weather page thermometer, counted from its top */
+#define THERMO_TOP_ROW          3  // mark of the max label
+#define THERMO_BOTTOM_ROW       76 // mark of the min label
+#define THERMO_MERCURY_LAST_ROW 81 // the mercury reaches into the bulb
+
+/* The static part of a thermometer covers 12 columns either side of the tube
+ * centre and 103 rows, down to the bottom of the bulb */
+#define THERMO_SPRITE_LEFT    12
+#define THERMO_SPRITE_WIDTH   25
+#define THERMO_SPRITE_HEIGHT  103
+#define THERMO_SPRITE_COLUMNS ((1u << THERMO_SPRITE_WIDTH) - 1)
+/* Sprite columns of the glass tube, 2 either side of the centre */
+#define THERMO_TUBE_COLUMNS   (0x1Fu << (THERMO_SPRITE_LEFT - 2))
+
+#define WEATHER_THERMOMETERS 3
+#define WEATHER_Y            3
+
+/* What the weather page shows for one thermometer */
+typedef struct WeatherThermometer {
+	char value[6]; // reading above the thermometer
+	char scale; // symbol in the bulb
+	int32_t min; // labels of the marks
+	int32_t max;
+	uint32_t levelRow; // top of the mercury
+} WeatherThermometer;
+
+/* Left edges of the C, F and RH readings */
+static const int32_t weatherX[WEATHER_THERMOMETERS] = { 6, 64 - 17, 127 - 40 };
+
+/* Frame, bulb and marks of a thermometer, one bit per pixel, bit 0 leftmost.
+ * In each row only the columns from spanFirst to spanLast are part of it, the
+ * rest is left as it is, as with the primitives. */
+static uint32_t thermometerSprite[THERMO_SPRITE_HEIGHT];
+static uint8_t thermometerSpanFirst[THERMO_SPRITE_HEIGHT];
+static uint8_t thermometerSpanLast[THERMO_SPRITE_HEIGHT];
+static bool thermometerSpriteValid = false;
+/* Cleared by clear_screen(), the next weather frame is then drawn in full */
+static bool weatherOnScreen = false;
+static bool weatherResetShown;
+static WeatherThermometer weatherShown[WEATHER_THERMOMETERS];
+
 static const uint8_t bitmap_bell_static_32[] = { 0x00, 0x00, 0x00, 0x00, 0x00,
 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -100,22 +157,60 @@ static void GRAPHICS_DrawTemperatureF(int32_t xoffset, int32_t yoffset,
 		int32_t tempData);
 static void GRAPHICS_DrawHumidity(int32_t xoffset, int32_t yoffset,
 		uint32_t rhData);
-static void GRAPHICS_CreateString(char *string, int32_t value);
-static void GRAPHICS_DrawThermometer_Weather_Station(int32_t xoffset,
-		int32_t yoffset, int32_t min, int32_t max, int32_t level, char scale);
-static void GRAPHICS_DrawTemperatureC_Weather_Station(int32_t xoffset,
-		int32_t yoffset, int32_t tempData, int32_t temp_min_mC,
-		int32_t temp_max_mC);
-static void GRAPHICS_DrawTemperatureF_Weather_Station(int32_t xoffset,
-		int32_t yoffset, int32_t tempData, int32_t temp_min_mC,
-		int32_t temp_max_mC);
-static void GRAPHICS_DrawHumidity_Weather_Station(int32_t xoffset,
-		int32_t yoffset, int32_t rhData, int32_t humidity_min,
-		int32_t humidity_max);
 static void GRAPHICS_DrawThermometerFrame(int32_t xoffset, int32_t yoffset);
+static void capture_thermometer_sprite(void);
 void GLIB_drawStringCentered(GLIB_Context_t *pContext, const char *s,
 		unsigned int len, int xCenter, int y, bool opaque);
 
+/***************************************************************************//**
+ * @brief Sets up the map of the values 0..range onto 0..span pixels, span
+ *        below 256.
+ * @note  Mapping a value then costs a multiplication and a shift, and the only
+ *        division is the one here. For range below PIXEL_SCALE_RANGE_MAX the
+ *        result is exactly floor(value * span / range): the factor rounded up
+ *        errs by less than value / 2^24 <= range / 2^24 pixel, which is less
+ *        than the 1 / range that separates the exact result from the next
+ *        integer. Larger ranges are halved together with the values, which
+ *        rounds the values down first. A range of 0 maps everything to 0.
+ ******************************************************************************/
+static PixelScale pixel_scale(uint32_t range, uint32_t span) {
+	PixelScale scale = { 0, 0 };
+
+	while (range >= PIXEL_SCALE_RANGE_MAX) {
+		range >>= 1;
+		scale.shift++;
+	}
+	if (range != 0) {
+		scale.factor = ((span << PIXEL_SCALE_Q) + range - 1) / range;
+	}
+	return scale;
+}
+
+// value must be at most the range the scale was set up for
+static uint32_t scale_to_pixels(PixelScale scale, uint32_t value) {
+	return ((value >> scale.shift) * scale.factor) >> PIXEL_SCALE_Q;
+}
+
+static void clear_screen(void) {
+	GLIB_clear(&glibContext);
+	weatherOnScreen = false;
+}
+
+static void set_font(const GLIB_Font_t *font, uint32_t scale) {
+	GLIB_setFont(&glibContext, (GLIB_Font_t*) font);
+	fontScale = scale;
+}
+
+/***************************************************************************//**
+ * @brief GLIB_drawString with the font set by set_font(). Goes through the
+ *        glyph blitter at every scale, which writes the frame buffer bytes
+ *        directly instead of plotting single pixels.
+ ******************************************************************************/
+static void draw_string(const char *s, uint32_t len, int32_t x, int32_t y,
+		bool opaque) {
+	GLYPH_DrawString(&glibContext, s, len, x, y, fontScale, opaque);
+}
+
 /***************************************************************************//**
  * @brief Initializes the graphics stack.
  * @note This function will /hang/ if errors occur (usually
@@ -147,8 +242,14 @@ void GRAPHICS_Init(void) {
 	glibContext.backgroundColor = Black;
 	glibContext.foregroundColor = White;
 
+	/* Only transmit changed rows, falls back to full updates on failure */
+	LCD_Init();
+
+	/* Pre-render the static part of the weather page thermometers */
+	capture_thermometer_sprite();
+
 	/* Use Narrow font */
-	GLIB_setFont(&glibContext, (GLIB_Font_t *) &GLIB_FontNarrow6x8);
+	set_font((GLIB_Font_t *) &GLIB_FontNarrow6x8, 1);
 }
 
 /***************************************************************************//**
@@ -160,18 +261,16 @@ void GRAPHICS_Init(void) {
  *        pixels
  ******************************************************************************/
 void GRAPHICS_ShowStatus(bool si7013_status, bool lowBat) {
-	GLIB_clear(&glibContext);
+	clear_screen();
 
 	if (lowBat) {
-		GLIB_drawString(&glibContext, "Low battery!", 16, 5, 115, 0);
+		draw_string("Low battery!", 16, 5, 115, 0);
 	} else if (!si7013_status) {
-		GLIB_drawString(&glibContext, "Failed to detect\nsi7021 sensor.", 32, 5,
-				5, 0);
+		draw_string("Failed to detect\nsi7021 sensor.", 32, 5, 5, 0);
 	} else {
-		GLIB_drawString(&glibContext, "si7021 sensor ready.\n"DEMO_VERSION, 32,
-				5, 5, 0);
+		draw_string("si7021 sensor ready.\n"DEMO_VERSION, 32, 5, 5, 0);
 	}
-	DMD_updateDisplay();
+	LCD_Flush();
 }
 
 /***************************************************************************//**
@@ -180,15 +279,17 @@ void GRAPHICS_ShowStatus(bool si7013_status, bool lowBat) {
  *        Temperature data (given in Celsius) multiplied by 1000
  * @param rhData
  *        Relative humidity (in percent), multiplied by 1000.
+ * @param t
+ *        Time to show, kept up to date by the 1 Hz tick.
  * @param degF
  *        Set to 0 to display temperature in Celsius, otherwise Fahrenheit.
  ******************************************************************************/
-void GRAPHICS_Draw_Clock(int32_t tempData, uint32_t rhData, uint32_t sec, bool alarm,
-		bool ring, bool lowBat) {
-	GLIB_clear(&glibContext);
+void GRAPHICS_Draw_Clock(int32_t tempData, uint32_t rhData, const Time *t,
+		bool alarm, bool ring, bool lowBat) {
+	clear_screen();
 
 	if (lowBat) {
-		GLIB_drawString(&glibContext, "LOW BATTERY!", 12, 5, 120, 0);
+		draw_string("LOW BATTERY!", 12, 5, 120, 0);
 	} else {
 		/* Draw temperature and RH */
 		//GRAPHICS_DrawTemperatureC(6, 3, tempData);
@@ -196,9 +297,6 @@ void GRAPHICS_Draw_Clock(int32_t tempData, uint32_t rhData, uint32_t sec, bool a
 		//GRAPHICS_DrawHumidity(127 - 40, 3, rhData);
 		char str[50];
 
-		Time t;
-		t = GetCurrTime(sec);
-
 		if (!alarm && !ring) {
 			GLIB_drawBitmap(&glibContext, 5, 5, 32, 32, bitmap_bell_x_32);
 		} else {
@@ -208,15 +306,15 @@ void GRAPHICS_Draw_Clock(int32_t tempData, uint32_t rhData, uint32_t sec, bool a
 			} else {
 				if (ring) {
 
-					if (sec % 3 == 0) {
+					if (t->tm_sec % 3 == 0) {
 						GLIB_drawBitmap(&glibContext, 5, 5, 32, 32,
 								bitmap_bell_static_32);
 					}
-					if (sec % 3 == 1) {
+					if (t->tm_sec % 3 == 1) {
 						GLIB_drawBitmap(&glibContext, 5, 5, 32, 32,
 								bitmap_bell_ring_f1);
 					}
-					if (sec % 3 == 2) {
+					if (t->tm_sec % 3 == 2) {
 						GLIB_drawBitmap(&glibContext, 5, 5, 32, 32,
 								bitmap_bell_ring_f2);
 					}
@@ -224,135 +322,148 @@ void GRAPHICS_Draw_Clock(int32_t tempData, uint32_t rhData, uint32_t sec, bool a
 			}
 		}
 
-		GLIB_setFont(&glibContext, (GLIB_Font_t *) &GLIB_font7Segment);
-		snprintf(str, 50, "%d%d:%d%d:%d%d", t.tm_hour / 10, t.tm_hour % 10,
-				t.tm_min / 10, t.tm_min % 10, t.tm_sec / 10, t.tm_sec % 10);
+		set_font((GLIB_Font_t *) &GLIB_font7Segment, SEGMENT_FONT_SCALE);
+		FORMAT_Time(str, t);
 
-		GLIB_drawString(&glibContext, str, 25, 5, 50, 0);
+		draw_string(str, 25, 5, 50, 0);
 
-		snprintf(str, 50, "%d%d/%d%d/%d", t.tm_mday / 10, t.tm_mday % 10,
-				t.tm_mon / 10, t.tm_mon % 10, t.tm_year);
+		FORMAT_Date(str, t);
 
-		GLIB_drawString(&glibContext, str, 25, 5, 75, 0);
+		draw_string(str, 25, 5, 75, 0);
 
-		snprintf(str, 10, "%d%d.%d%d'C", (tempData / 1000 % 100) / 10,
-				(tempData / 1000 % 1000) / 100,
-				(tempData / 1000 % 10000) / 1000,
-				(tempData / 1000 % 100000) / 10000);
-		GLIB_drawString(&glibContext, str, 25, 30, 95, 0);
+		FORMAT_String(FORMAT_Milli2(str, tempData), "'C");
+		draw_string(str, 25, 30, 95, 0);
 	}
-	DMD_updateDisplay();
+	LCD_Flush();
 }
 
-void GRPAHICS_DrawTimeAdj(int32_t pos_h, uint32_t time, int32_t offset,
-bool blink, bool lowBat) {
-	GLIB_clear(&glibContext);
+void GRPAHICS_DrawTimeAdj(int32_t pos_h, const Time *t, bool blink,
+		bool lowBat) {
+	clear_screen();
 
 	if (lowBat) {
-		GLIB_drawString(&glibContext, "LOW BATTERY!", 12, 5, 120, 0);
+		draw_string("LOW BATTERY!", 12, 5, 120, 0);
 	} else {
 		char str[50];
 
-		GLIB_setFont(&glibContext, (GLIB_Font_t *) &GLIB_font7Segment);
-
-		Time t = GetCurrTime(time + offset);
+		set_font((GLIB_Font_t *) &GLIB_font7Segment, SEGMENT_FONT_SCALE);
 
 		if (pos_h != 0 || (pos_h == 0 && blink)) {
-			snprintf(str, 50, "%d%d:", t.tm_hour / 10, t.tm_hour % 10);
-			GLIB_drawString(&glibContext, str, 36, 5, 5, pos_h == 0);
+			FORMAT_String(FORMAT_TwoDigits(str, t->tm_hour), ":");
+			draw_string(str, 36, 5, 5, pos_h == 0);
 		}
 		if (pos_h != 1 || (pos_h == 1 && blink)) {
-			snprintf(str, 50, "%d%d:", t.tm_min / 10, t.tm_min % 10);
-			GLIB_drawString(&glibContext, str, 36, 41, 5, pos_h == 1);
+			FORMAT_String(FORMAT_TwoDigits(str, t->tm_min), ":");
+			draw_string(str, 36, 41, 5, pos_h == 1);
 		}
 		if (pos_h != 2 || (pos_h == 2 && blink)) {
-			snprintf(str, 50, "%d%d", t.tm_sec / 10, t.tm_sec % 10);
-			GLIB_drawString(&glibContext, str, 24, 77, 5, pos_h == 2);
+			FORMAT_TwoDigits(str, t->tm_sec);
+			draw_string(str, 24, 77, 5, pos_h == 2);
 		}
 		if (pos_h != 3 || (pos_h == 3 && blink)) {
-			snprintf(str, 50, "%d%d/", t.tm_mday / 10, t.tm_mday % 10);
-			GLIB_drawString(&glibContext, str, 36, 5, 25, pos_h == 3);
+			FORMAT_String(FORMAT_TwoDigits(str, t->tm_mday), "/");
+			draw_string(str, 36, 5, 25, pos_h == 3);
 		}
 		if (pos_h != 4 || (pos_h == 4 && blink)) {
-			snprintf(str, 50, "%s", month[t.tm_mon - 1]);
-			GLIB_drawString(&glibContext, str, 48, 41, 25, pos_h == 4);
+			FORMAT_Month(str, t->tm_mon);
+			draw_string(str, 48, 41, 25, pos_h == 4);
 		}
 		if (pos_h != 5 || (pos_h == 5 && blink)) {
-			snprintf(str, 50, "%d", t.tm_year);
-			GLIB_drawString(&glibContext, str, 38, 5, 50, pos_h == 5);
+			FORMAT_Int(str, t->tm_year);
+			draw_string(str, 38, 5, 50, pos_h == 5);
 		}
 		if (pos_h != 6 || (pos_h == 6 && blink)) {
-			snprintf(str, 50, "CONFIRM");
-			GLIB_drawString(&glibContext, str, 25, 5, 75, pos_h == 6);
+			draw_string("CONFIRM", 25, 5, 75, pos_h == 6);
 		}
 		if (pos_h != 7 || (pos_h == 7 && blink)) {
-			snprintf(str, 50, "CANCEL");
-			GLIB_drawString(&glibContext, str, 25, 5, 100, pos_h == 7);
+			draw_string("CANCEL", 25, 5, 100, pos_h == 7);
 		}
 	}
 
-	DMD_updateDisplay();
+	LCD_Flush();
 }
 
-void GRAPHICS_DrawAlarmSet(uint32_t alarmTime, AlarmType type, Day day,
-		int8_t sel, bool blink, bool lowBat) {
-	GLIB_clear(&glibContext);
+/***************************************************************************//**
+ * @brief Draws one entry of the alarm table while it is being edited.
+ * @param slot
+ *        Index of the entry in the alarm table.
+ * @param sel
+ *        Edited field: 0 slot, 1 off/once/repeat, 2-4 hour/minute/second,
+ *        5-11 Monday to Sunday, 12 confirm.
+ ******************************************************************************/
+void GRAPHICS_DrawAlarmSet(uint32_t slot, const Alarm *alarm, int8_t sel,
+		bool blink, bool lowBat) {
+	clear_screen();
 
 	if (lowBat) {
-		GLIB_drawString(&glibContext, "LOW BATTERY!", 12, 5, 120, 0);
+		draw_string("LOW BATTERY!", 12, 5, 120, 0);
 	} else {
 		char str[50];
 
-		GLIB_setFont(&glibContext, (GLIB_Font_t *) &GLIB_font7Segment);
+		set_font((GLIB_Font_t *) &GLIB_font7Segment, SEGMENT_FONT_SCALE);
 
-		Time t = GetCurrTime(alarmTime);
+		Time t = GetCurrTime(alarm->time_of);
 		if (sel != 0 || (sel == 0 && blink)) {
-			if (type == SIMPLE) {
-				snprintf(str, 50, "SIMPLE");
-				GLIB_drawString(&glibContext, str, 36, 5, 0, sel == 0);
+			FORMAT_TwoDigits(FORMAT_String(str, "AL"), slot + 1);
+			draw_string(str, 36, 5, 0, sel == 0);
+		}
+		if (sel != 1 || (sel == 1 && blink)) {
+			const char *type;
+
+			if (!alarm->enabled) {
+				type = "OFF";
 			} else {
-				if (type == REPEATABLE) {
-					snprintf(str, 50, "REPEAT");
-					GLIB_drawString(&glibContext, str, 36, 5, 0, sel == 0);
+				if (alarm->type == SIMPLE) {
+					type = "ONCE";
+				} else {
+					type = "RPT";
 				}
 			}
+			draw_string(type, 36, 70, 0, sel == 1);
 		}
 
-		if (sel != 1 || (sel == 1 && blink)) {
-			snprintf(str, 50, "%d%d:", t.tm_hour / 10, t.tm_hour % 10);
-			GLIB_drawString(&glibContext, str, 36, 5, 25, sel == 0);
-		}
 		if (sel != 2 || (sel == 2 && blink)) {
-			snprintf(str, 50, "%d%d:", t.tm_min / 10, t.tm_min % 10);
-			GLIB_drawString(&glibContext, str, 36, 41, 25, sel == 1);
+			FORMAT_String(FORMAT_TwoDigits(str, t.tm_hour), ":");
+			draw_string(str, 36, 5, 25, sel == 2);
 		}
 		if (sel != 3 || (sel == 3 && blink)) {
-			snprintf(str, 50, "%d%d", t.tm_sec / 10, t.tm_sec % 10);
-			GLIB_drawString(&glibContext, str, 24, 77, 25, sel == 2);
+			FORMAT_String(FORMAT_TwoDigits(str, t.tm_min), ":");
+			draw_string(str, 36, 41, 25, sel == 3);
+		}
+		if (sel != 4 || (sel == 4 && blink)) {
+			FORMAT_TwoDigits(str, t.tm_sec);
+			draw_string(str, 24, 77, 25, sel == 4);
 		}
-		if ((sel != 4 || (sel == 4 && blink)) && type == REPEATABLE) {
-			snprintf(str, 50, "RPT: %s", days[day]);
-			GLIB_drawString(&glibContext, str, 50, 5, 50, sel == 3);
+		if (alarm->type == REPEATABLE) {
+			for (int8_t day = MON; day <= SUN; day++) {
+				if (sel != 5 + day || (sel == 5 + day && blink)) {
+					if (alarm->days & ALARM_DAY(day)) {
+						FORMAT_DayLetter(str, day);
+					} else {
+						FORMAT_String(str, "-");
+					}
+					draw_string(str, 1, 5 + 14 * day, 50, sel == 5 + day);
+				}
+			}
 		}
 
-		if (sel != 5 || (sel == 5 && blink)) {
-			snprintf(str, 50, "CONFIRM");
-			GLIB_drawString(&glibContext, str, 25, 5, 75, sel == 6);
+		if (sel != 12 || (sel == 12 && blink)) {
+			draw_string("CONFIRM", 25, 5, 75, sel == 12);
 		}
 	}
 
-	DMD_updateDisplay();
+	LCD_Flush();
 }
 
 void GRAPHICS_DrawMenu(int32_t selectedPage, bool lowBat) {
-	GLIB_clear(&glibContext);
+	clear_screen();
 
 	if (lowBat) {
-		GLIB_drawString(&glibContext, "LOW BATTERY!", 12, 5, 120, 0);
+		draw_string("LOW BATTERY!", 12, 5, 120, 0);
 	} else {
 		char str[50];
 
-		GLIB_setFont(&glibContext, (GLIB_Font_t *) &GLIB_font7Segment);
+		set_font((GLIB_Font_t *) &GLIB_font7Segment, SEGMENT_FONT_SCALE);
 
 		int8_t offset = selectedPage - MAX_ITEMS_IN_MENU + 1;
 
@@ -361,71 +472,21 @@ void GRAPHICS_DrawMenu(int32_t selectedPage, bool lowBat) {
 		}
 
 		for (int8_t i = 0; i < MAX_ITEMS_IN_MENU; i++) {
+			int8_t item = i + offset;
+			char *label = str;
 
-			if (i + offset == 0) {
-				if (selectedPage == 0) {
-					snprintf(str, 50, ">Clock");
-					GLIB_drawString(&glibContext, str, 25, 5, 25 * i, 0);
-				} else {
-					snprintf(str, 50, "Clock");
-					GLIB_drawString(&glibContext, str, 25, 5, 25 * i, 0);
-				}
-			}
-
-			if (i + offset == 1) {
-				if (selectedPage == 1) {
-					snprintf(str, 50, ">Weather");
-					GLIB_drawString(&glibContext, str, 25, 5, 25 * i, 0);
-				} else {
-					snprintf(str, 50, "Weather");
-					GLIB_drawString(&glibContext, str, 25, 5, 25 * i, 0);
-				}
-			}
-
-			if (i + offset == 2) {
-				if (selectedPage == 2) {
-					snprintf(str, 50, ">Clk Conf");
-					GLIB_drawString(&glibContext, str, 25, 5, 25 * i, 0);
-				} else {
-					snprintf(str, 50, "Clk Conf");
-					GLIB_drawString(&glibContext, str, 25, 5, 25 * i, 0);
-				}
+			if (item >= MENU_LABEL_COUNT) {
+				break;
 			}
-
-			if (i + offset == 3) {
-				if (selectedPage == 3) {
-					snprintf(str, 50, ">Wth Conf");
-					GLIB_drawString(&glibContext, str, 25, 5, 25 * i, 0);
-				} else {
-					snprintf(str, 50, "Wth Conf");
-					GLIB_drawString(&glibContext, str, 25, 5, 25 * i, 0);
-				}
+			if (item == selectedPage) {
+				*label++ = '>';
 			}
-
-			if (i + offset == 4) {
-				if (selectedPage == 4) {
-					snprintf(str, 50, ">Alarm");
-					GLIB_drawString(&glibContext, str, 25, 5, 25 * i, 0);
-				} else {
-					snprintf(str, 50, "Alarm");
-					GLIB_drawString(&glibContext, str, 25, 5, 25 * i, 0);
-				}
-			}
-
-			if (i + offset == 5) {
-				if (selectedPage == 5) {
-					snprintf(str, 50, ">Exit");
-					GLIB_drawString(&glibContext, str, 25, 5, 25 * i, 0);
-				} else {
-					snprintf(str, 50, "Exit");
-					GLIB_drawString(&glibContext, str, 25, 5, 25 * i, 0);
-				}
-			}
-
+			FORMAT_String(label, menu_labels[item]);
+			draw_string(str, 25, 5, 25 * i, 0);
 		}
 	}
 
-	DMD_updateDisplay();
+	LCD_Flush();
 }
 
 /***************************************************************************//**
@@ -443,8 +504,8 @@ static void GRAPHICS_DrawTemperatureF(int32_t xoffset, int32_t yoffset,
 
 	tempData = ((tempData * 9) / 5) + 32000;
 
-	GRAPHICS_CreateString(string, tempData);
-	GLIB_drawString(&glibContext, string, strlen(string), xoffset, yoffset, 0);
+	draw_string(string, FORMAT_Milli1(string, tempData) - string, xoffset,
+			yoffset, 0);
 
 	GRAPHICS_DrawThermometer(xoffset + 15, yoffset + 17, 95, tempData / 1000,
 			'F');
@@ -463,8 +524,8 @@ static void GRAPHICS_DrawTemperatureC(int32_t xoffset, int32_t yoffset,
 		int32_t tempData) {
 	char string[10];
 
-	GRAPHICS_CreateString(string, tempData);
-	GLIB_drawString(&glibContext, string, strlen(string), xoffset, yoffset, 0);
+	draw_string(string, FORMAT_Milli1(string, tempData) - string, xoffset,
+			yoffset, 0);
 
 	GRAPHICS_DrawThermometer(xoffset + 15, yoffset + 17, 35, tempData / 1000,
 			'C');
@@ -503,7 +564,9 @@ static void GRAPHICS_DrawThermometer(int32_t xoffset, int32_t yoffset,
 	/* Abs value and saturate at max */
 	level = levelNeg ? level * -1 : level;
 	level = level > (int32_t) max ? (int32_t) max : level;
-	curLevelY = yoffset + (((minLevelY - maxLevelY) * (max - level)) / max);
+	curLevelY = yoffset
+			+ scale_to_pixels(pixel_scale(max, minLevelY - maxLevelY),
+					max - level);
 
 	/* Moving part */
 	mercuryLevel.xMin = xoffset - 2;
@@ -529,15 +592,14 @@ static void GRAPHICS_DrawThermometer(int32_t xoffset, int32_t yoffset,
 	GLIB_drawLineH(&glibContext, xoffset - 6, minLevelY, xoffset + 6);
 	GLIB_drawLineH(&glibContext, xoffset - 6, maxLevelY, xoffset + 6);
 
-	GLIB_drawString(&glibContext, "0", 1, xoffset + 8, minLevelY - 4, 0);
-	snprintf(string, 4, "%ld", max);
-	GLIB_drawString(&glibContext, string, 4, xoffset + 8, maxLevelY - 4, 0);
+	draw_string("0", 1, xoffset + 8, minLevelY - 4, 0);
+	FORMAT_Int(string, max);
+	draw_string(string, 4, xoffset + 8, maxLevelY - 4, 0);
 
 	if (levelNeg) {
-		GLIB_drawString(&glibContext, "-", 1, xoffset - 2, yoffset + 87, 0);
+		draw_string("-", 1, xoffset - 2, yoffset + 87, 0);
 	} else {
-		GLIB_drawString(&glibContext, (char *) &scale, 1, xoffset - 2,
-				yoffset + 87, 0);
+		draw_string((char *) &scale, 1, xoffset - 2, yoffset + 87, 0);
 	}
 }
 
@@ -552,39 +614,13 @@ static void GRAPHICS_DrawHumidity(int32_t xoffset, int32_t yoffset,
 		uint32_t rhData) {
 	char string[10];
 
-	GRAPHICS_CreateString(string, rhData);
-	GLIB_drawString(&glibContext, string, strlen(string), xoffset, yoffset, 0);
+	draw_string(string, FORMAT_Milli1(string, rhData) - string, xoffset,
+			yoffset, 0);
 
 	GRAPHICS_DrawThermometer(xoffset + 15, yoffset + 17, 100, rhData / 1000,
 			'%');
 }
 
-/***************************************************************************//**
- * @brief Helper function for printing numbers. Consumes less space than
- *        snprintf. Limited to two digits and one decimal.
- * @param string
- *        The string to print32_t to
- * @param value
- *        The value to print
- ******************************************************************************/
-static void GRAPHICS_CreateString(char *string, int32_t value) {
-	if (value < 0) {
-		value = -value;
-		string[0] = '-';
-	} else {
-		string[0] = ' ';
-	}
-	string[5] = 0;
-	string[4] = '0' + (value % 1000) / 100;
-	string[3] = '.';
-	string[2] = '0' + (value % 10000) / 1000;
-	string[1] = '0' + (value % 100000) / 10000;
-
-	if (string[1] == '0') {
-		string[1] = ' ';
-	}
-}
-
 static void GRAPHICS_DrawThermometerFrame(int32_t xoffset, int32_t yoffset) {
 	GLIB_Rectangle_t thermoScale;
 
@@ -612,6 +648,12 @@ static void GRAPHICS_DrawThermometerFrame(int32_t xoffset, int32_t yoffset) {
 	/* Reset colors for drawing on top */
 	glibContext.backgroundColor = Black;
 	glibContext.foregroundColor = White;
+
+	/* Draw min/max marks */
+	GLIB_drawLineH(&glibContext, xoffset - 6, yoffset + THERMO_BOTTOM_ROW,
+			xoffset + 6);
+	GLIB_drawLineH(&glibContext, xoffset - 6, yoffset + THERMO_TOP_ROW,
+			xoffset + 6);
 }
 
 /**
@@ -647,184 +689,256 @@ void GLIB_drawStringCentered(GLIB_Context_t *pContext, const char *s,
 	GLIB_drawString(pContext, s, len, xStart, y, opaque);
 }
 
-void GRAPHICS_Draw_Weather_Station(int32_t tempData, int32_t rhData,
-bool lowBat, int32_t temp_min_mC, int32_t temp_max_mC, int32_t humidity_min,
-		int32_t humidity_max, bool weather_reset) {
-	GLIB_clear(&glibContext);
+/***************************************************************************//**
+ * @brief Fills in what a weather page thermometer shows.
+ * @param value
+ *        Reading in milli-units.
+ * @param min_m
+ *        Lowest reading since the reset, in milli-units.
+ * @param max_m
+ *        Highest reading since the reset, in milli-units.
+ ******************************************************************************/
+static void weather_thermometer(WeatherThermometer *t, int32_t value,
+		int32_t min_m, int32_t max_m, char scale) {
+	int32_t min = min_m / 1000;
+	int32_t max = max_m / 1000;
+	int32_t level = value / 1000;
 
-	if (lowBat) {
-		GLIB_drawString(&glibContext, "LOW BATTERY!", 12, 5, 120, 0);
-	} else {
-		/* Draw temperature and RH */
-		GRAPHICS_DrawTemperatureC_Weather_Station(6, 3, tempData, temp_min_mC,
-				temp_max_mC);
-		GRAPHICS_DrawTemperatureF_Weather_Station(64 - 17, 3, tempData,
-				temp_min_mC, temp_max_mC);
-		GRAPHICS_DrawHumidity_Weather_Station(127 - 40, 3, rhData, humidity_min,
-				humidity_max);
-		if(weather_reset) {
-		   GLIB_drawString(&glibContext, "SET", 3, 67, 120, 0);
+	FORMAT_Milli1(t->value, value);
+	t->min = min;
+	t->max = max;
+	t->scale = scale;
+
+	if (level < min)
+		level = min;
+	if (level > max)
+		level = max;
+	/* Unsigned differences, so that max below min (nothing measured since
+	 * the reset) still fills the tube */
+	t->levelRow = THERMO_BOTTOM_ROW
+			- scale_to_pixels(
+					pixel_scale((uint32_t) max - (uint32_t) min,
+							THERMO_BOTTOM_ROW - THERMO_TOP_ROW),
+					(uint32_t) level - (uint32_t) min);
+}
+
+/***************************************************************************//**
+ * @brief Copies rows first to last of the thermometer sprite into the frame
+ *        buffer, only the sprite columns set in columns.
+ * @note  Each row writes up to 4 bytes under a mask, however many pixels the
+ *        GLIB primitives would plot one by one.
+ * @param x
+ *        Centre of the tube.
+ * @param y
+ *        Top of the thermometer.
+ ******************************************************************************/
+static void blit_thermometer(uint8_t *frame, int32_t x, int32_t y,
+		uint32_t first, uint32_t last, uint32_t columns) {
+	int32_t left = x - THERMO_SPRITE_LEFT;
+	uint32_t shift = left & 7;
+	uint32_t bytes = (shift + THERMO_SPRITE_WIDTH + 7) >> 3;
+	uint8_t *line = frame + (y + first) * LCD_ROW_BYTES + (left >> 3);
+
+	for (uint32_t row = first; row <= last; row++, line += LCD_ROW_BYTES) {
+		uint32_t span = (2u << thermometerSpanLast[row])
+				- (1u << thermometerSpanFirst[row]);
+		uint32_t mask = (columns & span) << shift;
+		uint32_t bits = thermometerSprite[row] << shift;
+
+		for (uint32_t b = 0; b < bytes; b++) {
+			uint8_t m = mask >> (8 * b);
+
+			line[b] = (line[b] & ~m) | ((bits >> (8 * b)) & m);
 		}
 	}
-	DMD_updateDisplay();
 }
 
 /***************************************************************************//**
- * @brief Helper function for drawing the temperature in Celsius.
- * @param xoffset
- *        This parameter selects which part of the UI to show.
- * @param yoffset
- *        This parameter selects which part of the UI to show.
- * @param tempData
- *        Temperature data (given in Celsius) multiplied by 1000
- * @param temp_min_mC
- * 	      Min measured temperature from the sensor.
- * @param temp_max_mC
- * 		  Max measured temperature from the sensor.
+ * @brief Reads the first 32 columns of a frame buffer line.
  ******************************************************************************/
-static void GRAPHICS_DrawTemperatureC_Weather_Station(int32_t xoffset,
-		int32_t yoffset, int32_t tempData, int32_t temp_min_mC,
-		int32_t temp_max_mC) {
-	char string[10];
+static uint32_t read_line(const uint8_t *frame, uint32_t row) {
+	const uint8_t *line = frame + row * LCD_ROW_BYTES;
 
-	GRAPHICS_CreateString(string, tempData);
-	GLIB_drawString(&glibContext, string, strlen(string), xoffset, yoffset, 0);
-
-	GRAPHICS_DrawThermometer_Weather_Station(xoffset + 15, yoffset + 17,
-			temp_min_mC / 1000, temp_max_mC / 1000, tempData / 1000, 'C');
+	return line[0] | (line[1] << 8) | (line[2] << 16)
+			| ((uint32_t) line[3] << 24);
 }
 
 /***************************************************************************//**
- * @brief Helper function for drawing the temperature in Fahrenheit
- * @param xoffset
- *        This parameter selects which part of the UI to show.
- * @param yoffset
- *        This parameter selects which part of the UI to show.
- * @param tempData
- *        Temperature data (given in Celsius) multiplied by 1000
- * @param temp_min_mC
- * 	      Min measured temperature from the sensor.
- * @param temp_max_mC
- * 		  Max measured temperature from the sensor.
+ * @brief Renders the thermometer frame once and keeps it as a sprite.
+ * @note  Drawn by GLIB at the top left of the frame buffer and read back, so
+ *        the sprite matches the primitives pixel for pixel. It is drawn once
+ *        on black and once on white, the pixels that differ are the ones the
+ *        primitives leave alone. Every row of the shape must be one run of
+ *        drawn pixels, otherwise, or without access to the frame buffer, the
+ *        thermometers are drawn from primitives.
  ******************************************************************************/
-static void GRAPHICS_DrawTemperatureF_Weather_Station(int32_t xoffset,
-		int32_t yoffset, int32_t tempData, int32_t temp_min_mC,
-		int32_t temp_max_mC) {
-	char string[10];
+static void capture_thermometer_sprite(void) {
+	const uint8_t *frame = LCD_GetFrame();
 
-	tempData = ((tempData * 9) / 5) + 32000;
-	temp_min_mC = ((temp_min_mC * 9) / 5) + 32000;
-	temp_max_mC = ((temp_max_mC * 9) / 5) + 32000;
+	if (frame == NULL) {
+		return;
+	}
+
+	glibContext.backgroundColor = White;
+	GLIB_clear(&glibContext);
+	GRAPHICS_DrawThermometerFrame(THERMO_SPRITE_LEFT, 0);
+	// the sprite rows hold the drawing on white until the second pass
+	for (uint32_t row = 0; row < THERMO_SPRITE_HEIGHT; row++) {
+		thermometerSprite[row] = read_line(frame, row);
+	}
+	glibContext.backgroundColor = Black;
+	GLIB_clear(&glibContext);
+	GRAPHICS_DrawThermometerFrame(THERMO_SPRITE_LEFT, 0);
 
-	GRAPHICS_CreateString(string, tempData);
-	GLIB_drawString(&glibContext, string, strlen(string), xoffset, yoffset, 0);
+	for (uint32_t row = 0; row < THERMO_SPRITE_HEIGHT; row++) {
+		uint32_t bits = read_line(frame, row);
+		uint32_t drawn = ~(bits ^ thermometerSprite[row])
+				& THERMO_SPRITE_COLUMNS;
+		uint32_t first = 0;
+		uint32_t last = THERMO_SPRITE_WIDTH - 1;
 
-	GRAPHICS_DrawThermometer_Weather_Station(xoffset + 15, yoffset + 17,
-			temp_min_mC / 1000, temp_max_mC / 1000, tempData / 1000, 'F');
+		while (first < last && !((drawn >> first) & 1)) {
+			first++;
+		}
+		while (last > first && !((drawn >> last) & 1)) {
+			last--;
+		}
+		if (drawn != (2u << last) - (1u << first)) {
+			GLIB_clear(&glibContext);
+			return;
+		}
+		thermometerSprite[row] = bits & drawn;
+		thermometerSpanFirst[row] = first;
+		thermometerSpanLast[row] = last;
+	}
+	GLIB_clear(&glibContext);
+
+	thermometerSpriteValid = true;
 }
 
 /***************************************************************************//**
- * @brief Helper function for drawing the humidity part of the UI.
- * @param xoffset
- *        This parameter selects which part of the UI to show.
- * @param rhData
- *        Relative humidity (in percent), multiplied by 1000.
- * @param humidity_min
- * 		  Minimum humidity
- * @param humidity_max
- * 		  Maximum humidity
+ * @brief Draws the mercury column, after restoring the empty tube over the
+ *        previous one.
  ******************************************************************************/
-static void GRAPHICS_DrawHumidity_Weather_Station(int32_t xoffset,
-		int32_t yoffset, int32_t rhData, int32_t humidity_min,
-		int32_t humidity_max) {
-	char string[10];
-
-	GRAPHICS_CreateString(string, rhData);
-	GLIB_drawString(&glibContext, string, strlen(string), xoffset, yoffset, 0);
+static void draw_mercury(int32_t x, int32_t y, uint32_t levelRow) {
+	GLIB_Rectangle_t mercury;
+	uint8_t *frame = LCD_GetFrame();
+
+	mercury.xMin = x - 2;
+	mercury.xMax = x + 2;
+	mercury.yMin = y + THERMO_TOP_ROW;
+	mercury.yMax = y + THERMO_MERCURY_LAST_ROW;
+
+	if (thermometerSpriteValid && frame != NULL) {
+		blit_thermometer(frame, x, y, THERMO_TOP_ROW,
+				THERMO_MERCURY_LAST_ROW, THERMO_TUBE_COLUMNS);
+	} else {
+		glibContext.foregroundColor = Black;
+		GLIB_drawRectFilled(&glibContext, &mercury);
+		glibContext.foregroundColor = White;
+		GLIB_drawLineH(&glibContext, x - 6, y + THERMO_BOTTOM_ROW, x + 6);
+		GLIB_drawLineH(&glibContext, x - 6, y + THERMO_TOP_ROW, x + 6);
+	}
 
-	GRAPHICS_DrawThermometer_Weather_Station(xoffset + 15, yoffset + 17,
-			humidity_min / 1000, humidity_max / 1000, rhData / 1000, '%');
+	/* The marks are white as well, so the mercury can cover them */
+	mercury.yMin = y + levelRow;
+	GLIB_drawRectFilled(&glibContext, &mercury);
 }
 
-/**
- * @brief Draws the dynamic level and scale character for a thermometer graphic.
- * @note  This version ONLY draws the mercury level and the symbol in the bulb.
- *        It assumes the frame has already been drawn.
- */
+/***************************************************************************//**
+ * @brief Draws a weather page thermometer with its reading above it.
+ * @param xoffset
+ *        Left edge of the reading, the tube is 15 pixels to the right.
+ * @param yoffset
+ *        Top of the reading, the thermometer starts 17 pixels below.
+ ******************************************************************************/
 static void GRAPHICS_DrawThermometer_Weather_Station(int32_t xoffset,
-		int32_t yoffset, int32_t min, int32_t max, int32_t level, char scale) {
-	GLIB_Rectangle_t thermoScale;
-	GLIB_Rectangle_t mercuryLevel;
-	const uint32_t minLevelY = yoffset + 76;
-	const uint32_t maxLevelY = yoffset + 3;
-	uint32_t curLevelY;
-	char string[10];
+		int32_t yoffset, const WeatherThermometer *t) {
+	const int32_t x = xoffset + 15;
+	const int32_t y = yoffset + 17;
+	uint8_t *frame = LCD_GetFrame();
+	char string[12];
 
-	/* Draw outer frame of the thermometer */
-	glibContext.backgroundColor = Black;
-	glibContext.foregroundColor = White;
-	thermoScale.xMin = xoffset - 4;
-	thermoScale.xMax = xoffset + 4;
-	thermoScale.yMin = yoffset;
-	thermoScale.yMax = yoffset + 90;
-	GLIB_drawCircleFilled(&glibContext, xoffset, yoffset + 90, 12);
-	GLIB_drawRectFilled(&glibContext, &thermoScale);
+	draw_string(t->value, sizeof(t->value) - 1, xoffset, yoffset, true);
 
-	/* Draw the inner "glass" part of the thermometer */
-	glibContext.backgroundColor = White;
-	glibContext.foregroundColor = Black;
+	if (thermometerSpriteValid && frame != NULL) {
+		blit_thermometer(frame, x, y, 0, THERMO_SPRITE_HEIGHT - 1,
+				THERMO_SPRITE_COLUMNS);
+	} else {
+		GRAPHICS_DrawThermometerFrame(x, y);
+	}
+	draw_mercury(x, y, t->levelRow);
 
-	/* Glass bulb */
-	GLIB_drawCircleFilled(&glibContext, xoffset, yoffset + 90, 9);
-	/* Glass tube */
-	mercuryLevel.xMin = xoffset - 2;
-	mercuryLevel.xMax = xoffset + 2;
-	mercuryLevel.yMin = yoffset + 3;
-	mercuryLevel.yMax = yoffset + 90;
-	GLIB_drawRectFilled(&glibContext, &mercuryLevel);
+	set_font(&GLIB_FontNarrow6x8, 1);
 
-	/* Calculate and draw the "mercury" level */
-	if (level < min)
-		level = min;
-	if (level > max)
-		level = max;
-	float valueRatio = 0.0f;
-	if ((max - min) != 0) { // Prevent division by zero
-		valueRatio = (float) (level - min) / (float) (max - min);
-	}
-	curLevelY = minLevelY
-			- (uint32_t) (valueRatio * (float) (minLevelY - maxLevelY));
+	draw_string(string, FORMAT_Int(string, t->min) - string, x + 8,
+			y + THERMO_BOTTOM_ROW - 4, 0);
+	draw_string(string, FORMAT_Int(string, t->max) - string, x + 8,
+			y + THERMO_TOP_ROW - 4, 0);
 
-	mercuryLevel.xMin = xoffset - 2;
-	mercuryLevel.xMax = xoffset + 2;
-	mercuryLevel.yMin = curLevelY;
-	mercuryLevel.yMax = minLevelY + 5; // Overlap slightly into the bulb
-	GLIB_drawRectFilled(&glibContext, &mercuryLevel);
+	// Center the scale character in the bulb (assuming 6-pixel wide narrow font)
+	draw_string(&t->scale, 1, x - 3, y + 87, 0);
 
-	/* --- FONT SIZE CHANGE FOR THERMOMETER TEXT --- */
-	glibContext.backgroundColor = Black;
-	glibContext.foregroundColor = White;
+	set_font(&GLIB_FontNormal8x8, 1);
+}
 
-	/* Draw min/max lines */
-	GLIB_drawLineH(&glibContext, xoffset - 6, minLevelY, xoffset + 6);
-	GLIB_drawLineH(&glibContext, xoffset - 6, maxLevelY, xoffset + 6);
+/***************************************************************************//**
+ * @brief Draws the weather page.
+ * @note  When only the readings changed since the last weather frame, only
+ *        the readings and the mercury columns are redrawn. A new min/max, the
+ *        reset marker or anything else drawn in between redraws the page.
+ ******************************************************************************/
+void GRAPHICS_Draw_Weather_Station(int32_t tempData, int32_t rhData,
+bool lowBat, int32_t temp_min_mC, int32_t temp_max_mC, int32_t humidity_min,
+		int32_t humidity_max, bool weather_reset) {
+	WeatherThermometer next[WEATHER_THERMOMETERS];
+	bool full = !weatherOnScreen || weather_reset != weatherResetShown;
+
+	if (lowBat) {
+		clear_screen();
+		draw_string("LOW BATTERY!", 12, 5, 120, 0);
+		LCD_Flush();
+		return;
+	}
 
-	// 1. SET THE FONT to the smaller one.
-	GLIB_setFont(&glibContext, &GLIB_FontNarrow6x8);
+	weather_thermometer(&next[0], tempData, temp_min_mC, temp_max_mC, 'C');
+	weather_thermometer(&next[1], ((tempData * 9) / 5) + 32000,
+			((temp_min_mC * 9) / 5) + 32000, ((temp_max_mC * 9) / 5) + 32000,
+			'F');
+	weather_thermometer(&next[2], rhData, humidity_min, humidity_max, '%');
 
-	// 2. DRAW ALL THE TEXT using the new, smaller font.
-	snprintf(string, sizeof(string), "%ld", min);
-	GLIB_drawString(&glibContext, string, strlen(string), xoffset + 8,
-			minLevelY - 4, 0);
+	for (uint32_t i = 0; i < WEATHER_THERMOMETERS; i++) {
+		full |= next[i].min != weatherShown[i].min
+				|| next[i].max != weatherShown[i].max;
+	}
 
-	snprintf(string, sizeof(string), "%ld", max);
-	GLIB_drawString(&glibContext, string, strlen(string), xoffset + 8,
-			maxLevelY - 4, 0);
+	set_font(&GLIB_FontNormal8x8, 1);
 
-	// Center the scale character in the bulb (assuming 6-pixel wide narrow font)
-	GLIB_drawString(&glibContext, (char *) &scale, 1, xoffset - 3, yoffset + 87,
-			0);
+	if (full) {
+		clear_screen();
+		for (uint32_t i = 0; i < WEATHER_THERMOMETERS; i++) {
+			GRAPHICS_DrawThermometer_Weather_Station(weatherX[i], WEATHER_Y,
+					&next[i]);
+		}
+		if (weather_reset) {
+			draw_string("SET", 3, 67, 120, 0);
+		}
+		weatherOnScreen = true;
+	} else {
+		for (uint32_t i = 0; i < WEATHER_THERMOMETERS; i++) {
+			if (memcmp(next[i].value, weatherShown[i].value,
+					sizeof(next[i].value)) != 0) {
+				draw_string(next[i].value, sizeof(next[i].value) - 1,
+						weatherX[i], WEATHER_Y, true);
+			}
+			if (next[i].levelRow != weatherShown[i].levelRow) {
+				draw_mercury(weatherX[i] + 15, WEATHER_Y + 17,
+						next[i].levelRow);
+			}
+		}
+	}
 
-	// 3. IMPORTANT: SET THE FONT BACK to the default for the rest of the application.
-	GLIB_setFont(&glibContext, &GLIB_FontNormal8x8);
+	memcpy(weatherShown, next, sizeof(weatherShown));
+	weatherResetShown = weather_reset;
+	LCD_Flush();
 }
@@ -15,7 +15,6 @@
  *
  ******************************************************************************/
 
-#include <graphics_c.h>
 #include <stdbool.h>
 #include "em_device.h"
 #include "em_chip.h"
@@ -24,23 +23,30 @@
 #include "em_gpio.h"
 #include "em_rtc.h"
 #include "em_adc.h"
+#include "em_core.h"
 #include "i2cspm.h"
 #include "capsense.h"
 #include "si7013.h"
 #include "sl_sleeptimer.h"
+#include "sl_sleeptimer_slack.h"
+#include "sl_sleeptimer_deferred.h"
 #include "bspconfig.h"
 #include "clock_control.h"
+#include "alarm.h"
 #include "graphics.h"
 #include "dmd.h"
 #include "glib.h"
+#include "event_queue.h"
+#include "frame_scheduler.h"
+#include "buttons.h"
+#include "i2c_queue.h"
+#include "sensor.h"
+#include "sampling.h"
 
 /***************************************************************************//**
  * Local defines
  ******************************************************************************/
 
-/** Time (in ms) between periodic updates of the measurements. */
-#define MEASUREMENT_INTERVAL_MS      2000
-#define INTSEC 1000
 /** Voltage defined to indicate dead battery. */
 #define LOW_BATTERY_THRESHOLD   2800
 #define STANDBY_MODE 0
@@ -54,8 +60,35 @@ typedef enum Page {
 	SET_ALARM, //4
 	EXIT, //5
 	MENU, //6
+	PAGE_COUNT,
+	PAGE_STAY = PAGE_COUNT, // transition target: remain on the page
 } Page;
 
+// Button inputs the pages react to
+typedef enum UiInput {
+	UI_PB0,
+	UI_PB1,
+	UI_CHORD,
+	UI_INPUT_COUNT
+} UiInput;
+
+// Runs on an input and returns the page to go to, usually the table's next.
+typedef Page (*UiAction)(Page next);
+
+typedef struct Transition {
+	UiAction action; // can be NULL
+	Page next;
+} Transition;
+
+// One entry per page: what it renders, its hooks and its transitions
+typedef struct PageOps {
+	uint32_t inputs; // FRAME_INPUT_* the page is redrawn for
+	void (*enter)(Page from); // can be NULL
+	void (*exit)(void); // can be NULL
+	void (*render)(void); // can be NULL
+	Transition on[UI_INPUT_COUNT];
+} PageOps;
+
 /***************************************************************************//**
  * Local variables
  ******************************************************************************/
@@ -69,43 +102,51 @@ static volatile bool adcConversionComplete = false;
 /** This flag indicates that a new measurement shall be done. */
 static volatile bool measurement_flag = true;
 
-/** Timer used for periodic update of the measurements. */
-sl_sleeptimer_timer_handle_t measurement_timer;
-
 sl_sleeptimer_timer_handle_t sense_timer;
 
-/** Timer used for periodic update of the measurements. */
+/** Timer waking up on every second boundary of the clock. */
 sl_sleeptimer_timer_handle_t clk_timer;
 
 /** Timer used for periodic maintenance of the display **/
 sl_sleeptimer_timer_handle_t display_timer;
 
-// Baseline epoch
 static int blink_freq = 2;
-static volatile uint32_t cnt;
+// Change made so far on the time adjust page
 static volatile int32_t offsetInSeconds;
-static volatile int32_t offsetInSecondsPrev;
+// Displayed time (CLOCK_Get), advanced by time_callback
+static Calendar calendar;
+// Time shown while it is being adjusted (stopped_at_time + offsetInSeconds)
+static Calendar adjust_calendar;
 static volatile TimeType selectedType;
 static volatile int32_t temp;
 static volatile int32_t rh;
-static volatile int32_t page_state = 0;
-static volatile int32_t prev_page_state = 0;
-static volatile int32_t menu_selected = 0;
+static Page page_state = CLOCK;
+// page the menu returns to on EXIT
+static Page menu_return = CLOCK;
+static int32_t menu_selected = 0;
+
+// Latest sample and state the pages render
+static uint32_t rhData;
+static int32_t tempData;
+static bool lowBat = false;
+static bool blink = true;
 
 // alarm config
-static volatile Alarm alarm;
-static volatile bool alarm_set = false;
 static volatile bool ring = false;
+static uint32_t ring_left = 0;
+static uint32_t ring_index = 0;
 static volatile bool weather_reset = false;
-static volatile AlarmType type_selected = SIMPLE;
-static volatile uint8_t hour_set = 0;
-static volatile uint8_t min_set = 0;
-static volatile uint8_t sec_set = 0;
-static volatile Day repeat_on_set = MON;
+// 0 - slot
+// 1 - off/once/repeat
+// 2 - hour
+// 3 - minute
+// 4 - second
+// 5..11 - monday..sunday
+// 12 - confirm
 static volatile int8_t alarm_adj_state = 0;
+static uint32_t alarm_slot = 0;
+static Alarm alarm_edit;
 
-static volatile int btn0_state = 0;
-static volatile int btn1_state = 0;
 // 0 - hour
 // 1 - minute
 // 2 - second
@@ -123,18 +164,23 @@ static volatile uint32_t stopped_at_time;
 static void gpioSetup(void);
 static uint32_t checkBattery(void);
 static void adcInit(void);
-static void measure_humidity_and_temperature(I2C_TypeDef *i2c, uint32_t *rhData,
-		int32_t *tData, uint32_t *vBat);
-static void measurement_callback(sl_sleeptimer_timer_handle_t *handle,
-		void *data);
+static void handle_sample(void);
 static void time_callback(sl_sleeptimer_timer_handle_t *handle, void *data);
+static void schedule_alarm(void);
+static void handle_alarms(void);
+static void ring_due(const Calendar *now);
+static void load_alarm_slot(void);
+static void edit_alarm_field(void);
+static bool is_value_edit(uint32_t buttons);
+static void set_page(Page next);
+static void handle_buttons(uint32_t data);
+static Calendar current_calendar(void);
+static void sync_calendars(void);
+static void set_clock(uint32_t sec);
 //static void touch_callback(sl_sleeptimer_timer_handle_t *handle, void *data);
-void clear_display(void);
-void GRAPHICS_Draw(int32_t temp, uint32_t rh, uint32_t time, bool lowBat);
-void GRAPHICS_Draw_Weather_Station(int32_t tempData, uint32_t rhData,
-bool lowBat, int32_t temp_min_mC, int32_t temp_max_mC, uint32_t humidity_min,
-		uint32_t humidity_max, bool weather_reset);
 void resetTempHumidity(void);
+void resetMinMaxTemp(void);
+void resetMinMacHumidity(void);
 int32_t temp_min_mC = INT32_MAX; // min will always be the biggest 32bit value, so any real measured temp will be lower and replace it
 int32_t temp_max_mC = INT32_MIN; // max will always be the smallest 32bit value, so any real measured temp will be bigger and replace it
 int32_t humidity_min = INT32_MAX;
@@ -142,21 +188,426 @@ int32_t humidity_max = 0;
 GLIB_Context_t glibContext;
 
 static volatile bool is_w_station = false; // Promenliva za rejim na rabota meterologichna stancia
-static volatile bool redraw = false;
 
-void clear_display(void) {
-	EMSTATUS status;
+/***************************************************************************//**
+ * @brief  Returns a consistent copy of the calendar advanced by the tick.
+ ******************************************************************************/
+static Calendar current_calendar(void) {
+	CORE_DECLARE_IRQ_STATE;
+	Calendar c;
+
+	CORE_ENTER_ATOMIC();
+	c = calendar;
+	CORE_EXIT_ATOMIC();
+
+	return c;
+}
+
+/***************************************************************************//**
+ * @brief  Catches the calendars up with the displayed time. The usual one
+ *         second step is a CalendarTick, only a late tick redoes the full
+ *         date conversion. The alarm table changes in set_clock alone.
+ ******************************************************************************/
+static void sync_calendars(void) {
+	CORE_DECLARE_IRQ_STATE;
+
+	CORE_ENTER_ATOMIC();
+	uint32_t now = CLOCK_Get(NULL);
+	if (now == calendar.sec + 1) {
+		CalendarTick(&calendar);
+	} else if (now != calendar.sec) {
+		CalendarSet(&calendar, now);
+	}
+	CORE_EXIT_ATOMIC();
+
+	if (adjust_calendar.sec != stopped_at_time + offsetInSeconds) {
+		CalendarSet(&adjust_calendar, stopped_at_time + offsetInSeconds);
+	}
+}
+
+/***************************************************************************//**
+ * @brief  Sets the displayed time. Alarms due before the jump ring first, the
+ *         ones due at the new time ring right after it.
+ ******************************************************************************/
+static void set_clock(uint32_t sec) {
+	CORE_DECLARE_IRQ_STATE;
+	Calendar now;
+
+	sync_calendars();
+	now = current_calendar();
+	ring_due(&now);
+
+	CORE_ENTER_ATOMIC();
+	CLOCK_Set(sec);
+	CalendarSet(&calendar, sec);
+	ALARM_Rebuild(calendar.sec, &calendar.time, (int32_t) (sec - now.sec));
+	CORE_EXIT_ATOMIC();
+
+	handle_alarms();
+}
+
+/***************************************************************************//**
+ * @brief  Arms the alarm timer relative to the displayed time.
+ ******************************************************************************/
+static void schedule_alarm(void) {
+	uint32_t ticks;
+	uint32_t now = CLOCK_Get(&ticks);
+
+	ALARM_Arm(now, ticks);
+}
+
+/***************************************************************************//**
+ * @brief  Starts ringing every alarm that is due and arms the next one.
+ ******************************************************************************/
+static void handle_alarms(void) {
+	Calendar now = current_calendar();
+
+	ring_due(&now);
+	schedule_alarm();
+}
+
+/***************************************************************************//**
+ * @brief  Starts ringing every alarm that is due at now.
+ ******************************************************************************/
+static void ring_due(const Calendar *now) {
+	int32_t index;
+
+	while ((index = ALARM_Due(now->sec, &now->time)) >= 0) {
+		ring = true;
+		ring_index = index;
+		ring_left = ALARM_Get(index).ring_seconds;
+	}
+}
+
+/***************************************************************************//**
+ * @brief  Loads the selected alarm table entry into the edit buffer.
+ ******************************************************************************/
+static void load_alarm_slot(void) {
+	Calendar now = current_calendar();
+
+	alarm_edit = ALARM_Get(alarm_slot);
+	if (!alarm_edit.enabled) {
+		// an unused entry starts at the current time
+		alarm_edit.time_of = now.time.tm_hour * 3600 + now.time.tm_min * 60
+				+ now.time.tm_sec;
+	}
+}
+
+/***************************************************************************//**
+ * @brief  Changes the alarm field selected by alarm_adj_state.
+ ******************************************************************************/
+static void edit_alarm_field(void) {
+	Calendar now = current_calendar();
+
+	switch (alarm_adj_state) {
+	case 0:
+		alarm_slot = (alarm_slot + 1) % ALARM_MAX;
+		load_alarm_slot();
+		break;
+	case 1:
+		// off -> once -> repeat -> off
+		if (!alarm_edit.enabled) {
+			alarm_edit.enabled = true;
+			alarm_edit.type = SIMPLE;
+		} else {
+			if (alarm_edit.type == SIMPLE) {
+				alarm_edit.type = REPEATABLE;
+				if (alarm_edit.days == 0) {
+					alarm_edit.days = ALARM_DAY(now.time.tm_wday);
+				}
+			} else {
+				alarm_edit.enabled = false;
+				alarm_edit.type = SIMPLE;
+			}
+		}
+		break;
+	case 2:
+		alarm_edit.time_of += 3600;
+		break;
+	case 3:
+		alarm_edit.time_of += 60;
+		break;
+	case 4:
+		alarm_edit.time_of += 1;
+		break;
+	case 12:
+		ALARM_Store(alarm_slot, &alarm_edit, now.sec, &now.time);
+		schedule_alarm();
+		break;
+	default:
+		alarm_edit.days ^= ALARM_DAY(alarm_adj_state - 5);
+		break;
+	}
+
+	if (alarm_edit.time_of >= 24 * 3600) {
+		alarm_edit.time_of -= 24 * 3600;
+	}
+}
+
+/***************************************************************************//**
+ * @brief  Tells if holding the buttons should keep changing a value.
+ ******************************************************************************/
+static bool is_value_edit(uint32_t buttons) {
+	if (page_state == TIME_ADJUST) {
+		return (buttons == BUTTON_PB1 && date_adjust_state <= 5)
+				|| (buttons == BUTTON_PB0 && date_adjust_state == 5);
+	}
+	if (page_state == SET_ALARM) {
+		return buttons == BUTTON_PB1 && alarm_adj_state >= 2
+				&& alarm_adj_state <= 4;
+	}
+	return false;
+}
+
+static Page redraw_all(Page next) {
+	FRAME_Invalidate(FRAME_INPUT_ALL);
+	return next;
+}
+
+static void render_clock(void) {
+	Calendar now = current_calendar();
+
+	GRAPHICS_Draw_Clock(temp, rh, &now.time, ALARM_IsSet(), ring, lowBat);
+}
+
+static void render_weather(void) {
+	GRAPHICS_Draw_Weather_Station(tempData, rhData, lowBat, temp_min_mC,
+			temp_max_mC, humidity_min, humidity_max, weather_reset);
+}
+
+static void weather_enter(Page from) {
+	(void) from;
+	// the reading may be a whole backed-off period old
+	SAMPLING_Now();
+}
+
+static Page weather_reset_temp(Page next) {
+	if (weather_reset) {
+		weather_reset = false;
+		resetMinMaxTemp();
+	}
+	return next;
+}
+
+static Page weather_reset_humidity(Page next) {
+	if (weather_reset) {
+		weather_reset = false;
+		resetMinMacHumidity();
+		return PAGE_STAY;
+	}
+	return next;
+}
+
+static Page weather_toggle_reset(Page next) {
+	weather_reset = !weather_reset;
+	return next;
+}
+
+static void time_adjust_enter(Page from) {
+	(void) from;
+	date_adjust_state = 0;
+	stopped_at_time = CLOCK_Get(NULL);
+	offsetInSeconds = 0;
+}
+
+static void time_adjust_exit(void) {
+	// dropped unless it was applied
+	offsetInSeconds = 0;
+}
+
+static void render_time_adjust(void) {
+	GRPAHICS_DrawTimeAdj(date_adjust_state, &adjust_calendar.time, blink,
+			lowBat);
+}
+
+static Page time_adjust_next(Page next) {
+	if (date_adjust_state == 5) {
+		offsetInSeconds += adjustOffset(stopped_at_time + offsetInSeconds, YEAR,
+				INCR);
+	} else {
+		date_adjust_state = (date_adjust_state + 1) % 8;
+	}
+	return next;
+}
+
+static Page time_adjust_select(Page next) {
+	switch (date_adjust_state) {
+	case 5:
+		offsetInSeconds += adjustOffset(stopped_at_time + offsetInSeconds, YEAR,
+				DECR);
+		return next;
+	case 6:
+		set_clock(stopped_at_time + offsetInSeconds);
+		return MENU;
+	case 7:
+		// the clock kept running meanwhile
+		return MENU;
+	default:
+		offsetInSeconds += adjustOffset(stopped_at_time + offsetInSeconds,
+				date_adjust_state, INCR);
+		return next;
+	}
+}
+
+static Page time_adjust_chord(Page next) {
+	if (date_adjust_state == 5) {
+		date_adjust_state++;
+		return next;
+	}
+	return redraw_all(next);
+}
+
+static void alarm_enter(Page from) {
+	(void) from;
+	alarm_slot = 0;
+	alarm_adj_state = 0;
+	load_alarm_slot();
+}
 
-	// Clear the entire framebuffer in memory.
-	// This function uses the background color set in the glibContext.
-	status = GLIB_clear(&glibContext);
-	if (status != GLIB_OK) {
-		// Handle error if needed
+static void render_alarm(void) {
+	GRAPHICS_DrawAlarmSet(alarm_slot, &alarm_edit, alarm_adj_state, blink,
+			lowBat);
+}
+
+static Page alarm_next(Page next) {
+	alarm_adj_state = (alarm_adj_state + 1) % 13;
+	if (alarm_edit.type != REPEATABLE && alarm_adj_state == 5) {
+		alarm_adj_state = 12;
+	}
+	return next;
+}
+
+static Page alarm_select(Page next) {
+	bool store = (alarm_adj_state == 12);
+
+	edit_alarm_field();
+	return store ? CLOCK : next;
+}
+
+static void menu_enter(Page from) {
+	menu_selected = from;
+	if (from == CLOCK || from == WEATHER) {
+		menu_return = from;
+	}
+}
+
+static void render_menu(void) {
+	GRAPHICS_DrawMenu(menu_selected, lowBat);
+}
+
+static Page menu_next(Page next) {
+	menu_selected = (menu_selected == EXIT) ? 0 : menu_selected + 1;
+	return next;
+}
+
+static Page menu_select(Page next) {
+	(void) next;
+	return (menu_selected == EXIT) ? menu_return : (Page) menu_selected;
+}
+
+// Indexed by Page. A new page needs one entry here and a menu item.
+static const PageOps pages[PAGE_COUNT] = {
+	[CLOCK] = {
+		FRAME_INPUT_SECOND | FRAME_INPUT_CURSOR | FRAME_INPUT_BATTERY,
+		NULL, NULL, render_clock, {
+			[UI_PB0] = { NULL, PAGE_STAY },
+			[UI_PB1] = { NULL, MENU },
+			[UI_CHORD] = { redraw_all, PAGE_STAY } } },
+	[WEATHER] = {
+		FRAME_INPUT_SENSOR | FRAME_INPUT_CURSOR | FRAME_INPUT_BATTERY,
+		weather_enter, NULL, render_weather, {
+			[UI_PB0] = { weather_reset_temp, PAGE_STAY },
+			[UI_PB1] = { weather_reset_humidity, MENU },
+			[UI_CHORD] = { weather_toggle_reset, PAGE_STAY } } },
+	[TIME_ADJUST] = {
+		FRAME_INPUT_BLINK | FRAME_INPUT_CURSOR | FRAME_INPUT_BATTERY,
+		time_adjust_enter, time_adjust_exit, render_time_adjust, {
+			[UI_PB0] = { time_adjust_next, PAGE_STAY },
+			[UI_PB1] = { time_adjust_select, PAGE_STAY },
+			[UI_CHORD] = { time_adjust_chord, PAGE_STAY } } },
+	// not implemented yet, PB1 leaves
+	[WEATHER_ADJUST] = {
+		0,
+		NULL, NULL, NULL, {
+			[UI_PB0] = { NULL, PAGE_STAY },
+			[UI_PB1] = { NULL, MENU },
+			[UI_CHORD] = { redraw_all, PAGE_STAY } } },
+	[SET_ALARM] = {
+		FRAME_INPUT_BLINK | FRAME_INPUT_CURSOR | FRAME_INPUT_BATTERY,
+		alarm_enter, NULL, render_alarm, {
+			[UI_PB0] = { alarm_next, PAGE_STAY },
+			[UI_PB1] = { alarm_select, PAGE_STAY },
+			[UI_CHORD] = { redraw_all, PAGE_STAY } } },
+	// menu item only, menu_select never enters it
+	[EXIT] = {
+		0,
+		NULL, NULL, NULL, {
+			[UI_PB0] = { NULL, PAGE_STAY },
+			[UI_PB1] = { NULL, MENU },
+			[UI_CHORD] = { redraw_all, PAGE_STAY } } },
+	[MENU] = {
+		FRAME_INPUT_CURSOR | FRAME_INPUT_BATTERY,
+		menu_enter, NULL, render_menu, {
+			[UI_PB0] = { menu_next, PAGE_STAY },
+			[UI_PB1] = { menu_select, PAGE_STAY },
+			[UI_CHORD] = { redraw_all, PAGE_STAY } } },
+};
+
+/***************************************************************************//**
+ * @brief  Leaves the current page and enters next, unless it is PAGE_STAY or
+ *         the current page.
+ ******************************************************************************/
+static void set_page(Page next) {
+	Page from = page_state;
+
+	if (next == PAGE_STAY || next == from) {
 		return;
 	}
+	if (pages[from].exit != NULL) {
+		pages[from].exit();
+	}
+	page_state = next;
+	if (pages[next].enter != NULL) {
+		pages[next].enter(from);
+	}
+}
 
-	// Update the physical display with the content of the cleared framebuffer.
-	DMD_updateDisplay();
+/***************************************************************************//**
+ * @brief  Applies one button event to the page state.
+ * @note   A press acts once. Holding a button repeats it only where it
+ *         changes a value, never where it moves between pages.
+ ******************************************************************************/
+static void handle_buttons(uint32_t data) {
+	ButtonEventType type = BUTTON_EVENT_TYPE(data);
+	uint32_t buttons = BUTTON_EVENT_BUTTONS(data);
+	const Transition *transition;
+	UiInput input;
+
+	if (type == BUTTON_REPEAT && is_value_edit(buttons)) {
+		type = BUTTON_PRESS;
+	}
+	if (type == BUTTON_CHORD) {
+		input = UI_CHORD;
+	} else if (type == BUTTON_PRESS) {
+		input = (buttons == BUTTON_PB0) ? UI_PB0 : UI_PB1;
+	} else {
+		return;
+	}
+
+	// any button stops the alarm, PB0 only snoozes it
+	if (ring) {
+		ring = false;
+		if (input == UI_PB0) {
+			ALARM_Snooze(ring_index, current_calendar().sec);
+			schedule_alarm();
+		} else {
+			ALARM_Dismiss(ring_index);
+		}
+	}
+
+	transition = &pages[page_state].on[input];
+	set_page(transition->action != NULL ?
+			transition->action(transition->next) : transition->next);
 }
 
 /***************************************************************************//**
@@ -164,12 +615,9 @@ void clear_display(void) {
  ******************************************************************************/
 int main(void) {
 	I2CSPM_Init_TypeDef i2cInit = I2CSPM_INIT_DEFAULT;
-	uint32_t rhData;
 	bool si7013_status;
-	int32_t tempData;
 	uint32_t vBat = 3300;
 	bool lowBatPrevious = true;
-	bool lowBat = false;
 	/* Chip errata */
 	CHIP_Init();
 
@@ -177,313 +625,111 @@ int main(void) {
 	CMU_ClockSelectSet(cmuClock_LFA, cmuSelect_LFXO);
 	CMU_ClockEnable(cmuClock_HFLE, true);
 
-	RTC_Setup();
-
 	/* Initalize peripherals and drivers */
 	gpioSetup();
 	adcInit();
 	sl_sleeptimer_init();
+	CLOCK_Init();
+	BUTTONS_Init();
 	GRAPHICS_Init();
+	EVENTS_Init();
+	ALARM_Init();
+	// pins and clock only, the transfers run from the I2C interrupt
 	I2CSPM_Init(&i2cInit);
+	I2CQ_Init(i2cInit.port);
 	CAPSENSE_Init();
 
 	selectedType = HOUR;
+	CalendarSet(&calendar, CLOCK_Get(NULL));
+	CalendarSet(&adjust_calendar, stopped_at_time + offsetInSeconds);
 
 	/* Get initial sensor status */
-	si7013_status = Si7013_Detect(i2cInit.port, SI7021_ADDR, NULL);
+	SENSOR_Init(SI7021_ADDR);
+	si7013_status = SENSOR_Detect();
 	GRAPHICS_ShowStatus(si7013_status, false);
 	sl_sleeptimer_delay_millisecond(2000);
 
-	/* Set up periodic measurement timer */
-	sl_sleeptimer_start_periodic_timer_ms(&measurement_timer,
-	MEASUREMENT_INTERVAL_MS, measurement_callback, NULL, 0, 0);
+	/* Set up the measurement timer, its period follows the readings */
+	SAMPLING_Init(SAMPLING_BASE_MS);
 
 	//sl_sleeptimer_start_periodic_timer_ms(&sense_timer, 100, touch_callback, NULL, 0, 0);
 
-	sl_sleeptimer_start_periodic_timer_ms(&clk_timer, INTSEC, time_callback,
-	NULL, 0, 0);
-
-	EMU_EnterEM2(false);
-	// Buttons PB0 and PB1
-	GPIO_PinModeSet(BSP_GPIO_PB0_PORT, BSP_GPIO_PB0_PIN, gpioModeInputPull, 1);
-	GPIO_PinModeSet(BSP_GPIO_PB1_PORT, BSP_GPIO_PB1_PIN, gpioModeInputPull, 1);
+	uint32_t ticks;
+	CLOCK_Get(&ticks);
+	sl_sleeptimer_start_timer(&clk_timer, ticks, time_callback, NULL, 0,
+			SL_SLEEPTIMER_DEFERRED_CALLBACK_FLAG);
 
 	while (true) {
-
-		if (alarm_set) {
-			Time a_time = GetCurrTime(alarm.time_of);
-			Time t_time = GetCurrTime(cnt);
-
-			ring =
-					a_time.tm_hour == t_time.tm_hour
-							&& a_time.tm_min == t_time.tm_min
-							&& a_time.tm_sec == t_time.tm_sec
-							&& ((alarm.type == REPEATABLE
-									&& ((alarm.day_repeat == WEEKDAY
-											&& t_time.tm_wday >= 0
-											&& t_time.tm_wday < 5)
-											|| (alarm.day_repeat == WEEKEND
-													&& (t_time.tm_wday == 5
-															|| t_time.tm_wday
-																	== 6))
-											|| t_time.tm_wday
-													== alarm.day_repeat))
-									|| alarm.type == SIMPLE);
-
-			if (alarm.type == SIMPLE && ring) {
-				alarm_set = false;
-			}
-		}
-
-		if (ring) {
-			ring = cnt % 60 - alarm.time_of % 60 <= 59;
-		}
-
-		// Status of PB0 and PB1
-		btn0_state = GPIO_PinInGet(BSP_GPIO_PB0_PORT, BSP_GPIO_PB0_PIN);
-		btn1_state = GPIO_PinInGet(BSP_GPIO_PB1_PORT, BSP_GPIO_PB1_PIN);
-
-		// Determine mode of operation
-		if ((btn0_state == 0) && (btn1_state == 1)) {
-			if (ring) {
-				ring = false;
-			}
-
-			if (page_state == 6) {
-				if (menu_selected == 5) {
-					menu_selected = 0;
-				} else {
-					menu_selected = menu_selected + 1;
+		Event event;
+
+		// clock and measurement callbacks, kept out of the RTC interrupt
+		sl_sleeptimer_run_deferred_callbacks();
+
+		while (EVENTS_Pop(&event)) {
+			switch (event.type) {
+			case EVENT_TICK:
+				// catches up if a tick was late or the time was set
+				sync_calendars();
+				if (ring && --ring_left == 0) {
+					ring = false;
+					ALARM_Dismiss(ring_index);
 				}
-			} else {
-				if (page_state == 2) {
-					if (date_adjust_state == 5) {
-						offsetInSeconds += adjustOffset(
-								stopped_at_time + offsetInSeconds, YEAR, INCR);
-					} else {
-						date_adjust_state = (date_adjust_state + 1) % 8;
-					}
-				} else {
-					if (page_state == 4) {
-						alarm_adj_state = (alarm_adj_state + 1) % 6;
-						if (type_selected != REPEATABLE
-								&& alarm_adj_state == 4) {
-							alarm_adj_state = 5;
-						}
-					} else {
-						if (page_state == 1) {
-							if (weather_reset) {
-								weather_reset = !weather_reset;
-								resetMinMaxTemp();
-							}
-						}
-					}
+				FRAME_Invalidate(FRAME_INPUT_SECOND);
+				if (blink != (event.data % blink_freq == 0)) {
+					blink = !blink;
+					FRAME_Invalidate(FRAME_INPUT_BLINK);
 				}
+				break;
+			case EVENT_ALARM:
+				handle_alarms();
+				FRAME_Invalidate(FRAME_INPUT_SECOND);
+				break;
+			case EVENT_MEASURE:
+				measurement_flag = true;
+				break;
+			case EVENT_SAMPLE:
+				handle_sample();
+				break;
+			case EVENT_BUTTON:
+				handle_buttons(event.data);
+				sync_calendars();
+				FRAME_Invalidate(FRAME_INPUT_CURSOR);
+				break;
+			default:
+				break;
 			}
 		}
 
-		if ((btn0_state == 1) && (btn1_state == 0)) {
-			if (ring) {
-				ring = false;
-			}
-			if (page_state == 6) {
-				if (menu_selected == 5) {
-					page_state = prev_page_state;
-					menu_selected = prev_page_state;
-					prev_page_state = 6;
-				} else {
-					prev_page_state = 6;
-					page_state = menu_selected;
-					if (page_state == 2) {
-						prev_page_state = 0;
-						stopped_at_time = cnt;
-						offsetInSecondsPrev = offsetInSeconds;
-					} else {
-						if (page_state == 4) {
-							Time t = GetCurrTime(cnt);
-							hour_set = t.tm_hour;
-							min_set = t.tm_min;
-							sec_set = t.tm_sec;
-							type_selected = SIMPLE;
-							repeat_on_set = t.tm_wday + 1;
-						}
-					}
-				}
-			} else {
-				if (page_state == 0) {
-					prev_page_state = page_state;
-					menu_selected = page_state;
-					page_state = 6;
+		// The reading arrives later as EVENT_SAMPLE, the loop keeps running.
+		// A request while the sensor is busy is served by that measurement.
+		if (measurement_flag) {
+			measurement_flag = false;
+			if (SENSOR_Start()) {
+				bool lowBatPrev = lowBat;
+
+				vBat = checkBattery();
+				if (lowBatPrevious) {
+					lowBat = (vBat <= LOW_BATTERY_THRESHOLD);
 				} else {
-					if (page_state == 2) {
-						if (date_adjust_state != 5 && date_adjust_state != 6
-								&& date_adjust_state != 7) {
-							offsetInSeconds += adjustOffset(
-									stopped_at_time + offsetInSeconds,
-									date_adjust_state, INCR);
-						} else {
-							if (date_adjust_state == 5) {
-								offsetInSeconds += adjustOffset(
-										stopped_at_time + offsetInSeconds, YEAR,
-										DECR);
-							} else {
-								if (date_adjust_state == 6) {
-									cnt = stopped_at_time;
-									page_state = 6;
-								} else {
-									if (date_adjust_state == 7) {
-										cnt = stopped_at_time;
-										offsetInSeconds = offsetInSecondsPrev;
-										page_state = 6;
-									}
-								}
-							}
-						}
-					} else {
-						// yandere dev type of code
-						if (page_state == 4) {
-							if (alarm_adj_state == 0) {
-								type_selected = (type_selected + 1) % 2;
-							} else {
-								if (alarm_adj_state == 1) {
-									hour_set += 1;
-								} else {
-									if (alarm_adj_state == 2) {
-										min_set += 1;
-									} else {
-										if (alarm_adj_state == 3) {
-											sec_set += 1;
-										} else {
-											if (alarm_adj_state == 4) {
-												repeat_on_set = (repeat_on_set
-														+ 1) % 9;
-											} else {
-												if (alarm_adj_state == 5) {
-													page_state = 0;
-													alarm_set = true;
-													alarm =
-															(Alarm ) {
-																			type_selected,
-																			repeat_on_set,
-																			hour_set
-																					* 3600
-																					+ min_set
-																							* 60
-																					+ sec_set };
-												}
-											}
-										}
-									}
-								}
-							}
-
-							if (hour_set * 3600 + min_set * 60 + sec_set
-									>= 24 * 3600) {
-								uint32_t temp = (hour_set * 3600 + min_set * 60
-										+ sec_set) - 24 * 3600;
-								hour_set = temp / 3600;
-								min_set = (temp % 3600) / 60;
-								sec_set = temp % 60;
-							}
-						} else {
-							if (page_state == 1) {
-								if (weather_reset) {
-									weather_reset = !weather_reset;
-									resetMinMacHumidity();
-								} else {
-									prev_page_state = page_state;
-									menu_selected = page_state;
-									page_state = 6;
-								}
-							}
-						}
-					}
+					lowBat = false;
 				}
-			}
-		}
+				lowBatPrevious = (vBat <= LOW_BATTERY_THRESHOLD);
 
-		if ((btn0_state == 0) && (btn1_state == 0)) {
-			if (ring) {
-				ring = false;
-			}
-			if (page_state == 2 && date_adjust_state == 5) {
-				date_adjust_state++;
-			} else {
-				if (page_state == 1) {
-					weather_reset = !weather_reset;
-				} else {
-					redraw = true;
+				if (lowBat != lowBatPrev) {
+					FRAME_Invalidate(FRAME_INPUT_BATTERY);
 				}
 			}
 		}
 
-		if (((btn0_state == 1) && (btn1_state == 1))) {
-			redraw = true;
+		// Each GRAPHICS_Draw_* clears and flushes the frame itself
+		if (FRAME_Begin(page_state, pages[page_state].inputs)
+				&& pages[page_state].render != NULL) {
+			pages[page_state].render();
 		}
 
-		if (measurement_flag) {
-			measure_humidity_and_temperature(i2cInit.port, &rhData, &tempData,
-					&vBat);
-			if (tempData < temp_min_mC)
-				temp_min_mC = tempData;
-			if (tempData > temp_max_mC)
-				temp_max_mC = tempData;
-			if (rhData < humidity_min)
-				humidity_min = rhData;
-			if (rhData > humidity_max)
-				humidity_max = rhData;
-			if (lowBatPrevious) {
-				lowBat = (vBat <= LOW_BATTERY_THRESHOLD);
-			} else {
-				lowBat = false;
-			}
-			lowBatPrevious = (vBat <= LOW_BATTERY_THRESHOLD);
-		}
-		if (page_state == 0) {
-			clear_display();
-			GRAPHICS_Draw_Clock(temp, rh, cnt + offsetInSeconds, alarm_set,
-					ring, lowBat);
-			redraw = false;
-		} else {
-			if (page_state == 1) {
-				//if ((btn0_state == 0) && (btn1_state == 0)) {
-
-				//} else {
-				clear_display();
-				GRAPHICS_Draw_Weather_Station(tempData, rhData, lowBat,
-						temp_min_mC, temp_max_mC, humidity_min, humidity_max, weather_reset);
-				//}
-				redraw = false;
-			} else {
-				if (page_state == 2) {
-					clear_display();
-					GRPAHICS_DrawTimeAdj(date_adjust_state, stopped_at_time,
-							offsetInSeconds, cnt % blink_freq == 0, lowBat);
-					redraw = false;
-				} else {
-					if (page_state == 3) {
-
-					} else {
-						if (page_state == 4) {
-							clear_display();
-							GRAPHICS_DrawAlarmSet(
-									hour_set * 60 * 60 + min_set * 60 + sec_set,
-									type_selected, repeat_on_set,
-									alarm_adj_state, cnt % blink_freq == 0,
-									lowBat);
-						} else {
-							if (page_state == 6) {
-								clear_display();
-								GRAPHICS_DrawMenu(menu_selected, lowBat);
-								redraw = false;
-							}
-						}
-					}
-				}
-			}
-		}
+		// Sleep until the next timer, button or ADC event
+		EVENTS_WaitForEvent();
 	}
-	EMU_EnterEM2(false);
 }
 
 void resetMinMaxTemp(void) {
@@ -501,7 +747,7 @@ void resetTempHumidity(void) {
 	resetMinMacHumidity();
 }
 /***************************************************************************//**
- * @brief Setup GPIO interrupt for pushbuttons.
+ * @brief Setup GPIO, the buttons are set up by BUTTONS_Init.
  *****************************************************************************/
 static void gpioSetup(void) {
 	/* Enable GPIO clock */
@@ -509,20 +755,6 @@ static void gpioSetup(void) {
 
 	/* Enable si7021 sensor isolation switch */
 	GPIO_PinModeSet(gpioPortC, 8, gpioModePushPull, 1);
-
-	GPIO_PinModeSet(BSP_GPIO_PB0_PORT, BSP_GPIO_PB0_PIN, gpioModeInputPull, 1);
-	GPIO_IntConfig(BSP_GPIO_PB0_PORT, BSP_GPIO_PB0_PIN, false, true, true);
-
-	/* Configure PB1 as input and enable interrupt */
-	GPIO_PinModeSet(BSP_GPIO_PB1_PORT, BSP_GPIO_PB1_PIN, gpioModeInputPull, 1);
-	GPIO_IntConfig(BSP_GPIO_PB1_PORT, BSP_GPIO_PB1_PIN, false, true, true);
-
-#if defined(_EFM32_GIANT_FAMILY)
-	NVIC_EnableIRQ(GPIO_ODD_IRQn);
-#else
-	NVIC_EnableIRQ(GPIO_EVEN_IRQn);
-#endif
-
 }
 
 /***************************************************************************//**
@@ -551,6 +783,7 @@ void ADC0_IRQHandler(void) {
 	ADC_IntClear(ADC0, flags);
 
 	adcConversionComplete = true;
+	EVENTS_Post(EVENT_ADC_DONE, 0);
 }
 
 /***************************************************************************//**
@@ -581,90 +814,46 @@ static void adcInit(void) {
 	NVIC_EnableIRQ(ADC0_IRQn);
 }
 
-void GPIO_ODD_IRQHandler(void) {
-	/* Get and clear all pending GPIO interrupts */
-	uint32_t interruptMask = GPIO_IntGet();
-
-	/* Act on interrupts */
-	if (interruptMask & (1 << BSP_GPIO_PB0_PIN)) {
-		GPIO_IntClear(interruptMask);
-//	     if (mode == 0) {
-//	    	 display_cnt = cnt;
-//	    	 selectedType = HOUR;
-//	    	 mode = 1;
-//	     } else {
-//	    	 cnt = display_cnt;
-//	    	 mode = 0;
-//	     }
-	}
-
-	if (interruptMask & (1 << BSP_GPIO_PB1_PIN)) {
-		GPIO_IntClear(interruptMask);
-
-//	     if (mode == 1) {
-//	    	 if (selectedType == YEAR) {
-//	    		 selectedType = HOUR;
-//	    	 } else {
-//	    		 selectedType ++;
-//	    	 }
-//	     }
-	}
-}
+/***************************************************************************//**
+ * @brief Takes over the reading of a finished measurement.
+ ******************************************************************************/
+static void handle_sample(void) {
+	SensorSample sample;
 
-void GPIO_EVEN_IRQHandler(void) {
-	/* Get and clear all pending GPIO interrupts */
-	uint32_t interruptMask = GPIO_IntGet();
-
-	/* Act on interrupts */
-	if (interruptMask & (1 << BSP_GPIO_PB0_PIN)) {
-		GPIO_IntClear(interruptMask);
-//     if (mode == 0) {
-//    	 display_cnt = cnt;
-//    	 selectedType = HOUR;
-//    	 mode = 1;
-//     } else {
-//    	 cnt = display_cnt;
-//    	 mode = 0;
-//     }
+	if (!SENSOR_GetSample(&sample)) {
+		return;
 	}
-
-	if (interruptMask & (1 << BSP_GPIO_PB1_PIN)) {
-		GPIO_IntClear(interruptMask);
-//     if (mode == 1) {
-//    	 if (selectedType == YEAR) {
-//    		 selectedType = HOUR;
-//    	 } else {
-//    		 selectedType ++;
-//    	 }
-//     }
+	SAMPLING_Update(&sample);
+	if (sample.temp < temp_min_mC)
+		temp_min_mC = sample.temp;
+	if (sample.temp > temp_max_mC)
+		temp_max_mC = sample.temp;
+	if (sample.rh < humidity_min)
+		humidity_min = sample.rh;
+	if (sample.rh > humidity_max)
+		humidity_max = sample.rh;
+	if (sample.rh != rhData || sample.temp != tempData) {
+		rhData = sample.rh;
+		tempData = sample.temp;
+		FRAME_Invalidate(FRAME_INPUT_SENSOR);
 	}
 }
 
 /***************************************************************************//**
- * @brief  Helper function to perform data measurements.
+ * @brief Callback on a second boundary of the clock. Only redraws, the time
+ *        itself comes from the tick count, so a late callback cannot lose a
+ *        second.
  ******************************************************************************/
-static void measure_humidity_and_temperature(I2C_TypeDef *i2c, uint32_t *rhData,
-		int32_t *tData, uint32_t *vBat) {
-	*vBat = checkBattery();
-	Si7013_MeasureRHAndTemp(i2c, SI7021_ADDR, rhData, tData);
-}
-
-/***************************************************************************//**
- * @brief Callback from timer used to initiate new measurement
- ******************************************************************************/
-static void measurement_callback(sl_sleeptimer_timer_handle_t *handle,
-		void *data) {
-	(void) handle;
-	(void) data;
-	measurement_flag = true;
-}
-
 static void time_callback(sl_sleeptimer_timer_handle_t *handle, void *data) {
-	(void) handle;
-	(void) data;
-	cnt++;
-	measurement_flag = true;
-	redraw = true;
+	uint32_t ticks;
+	uint32_t now = CLOCK_Get(&ticks);
+
+	sl_sleeptimer_restart_timer(handle, ticks, time_callback, data, 0,
+			SL_SLEEPTIMER_DEFERRED_CALLBACK_FLAG);
+	if (now == calendar.sec + 1) {
+		CalendarTick(&calendar);
+	}
+	EVENTS_Post(EVENT_TICK, now);
 }
 
 /***************************************************************************//**
@@ -706,8 +895,9 @@ int rtcIntCallbackRegister(void (*pFunction)(void*), void* argument,
 	mem_lcd_callback_func = pFunction;
 	mem_lcd_callback_arg = argument;
 	uint32_t ticks = sl_sleeptimer_get_timer_frequency() / frequency;
-	sl_sleeptimer_start_periodic_timer(&display_timer, ticks, display_callback,
-	NULL, 0, 0);
+	// the polarity inversion may run up to half a period late
+	sl_sleeptimer_start_periodic_timer_slack(&display_timer, ticks, ticks / 2,
+			display_callback, NULL, 0, 0);
 
 	return 0;
 }
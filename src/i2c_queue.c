@@ -0,0 +1,174 @@
+/*
+ * i2c_queue.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "em_device.h"
+#include "em_core.h"
+#include "em_emu.h"
+#include "em_i2c.h"
+#include "event_queue.h"
+#include "i2c_queue.h"
+
+// every flag that advances the EMLIB master state machine
+#define TRANSFER_IEN (I2C_IEN_ACK | I2C_IEN_NACK | I2C_IEN_RXDATAV \
+		| I2C_IEN_MSTOP | I2C_IEN_ARBLOST | I2C_IEN_BUSERR)
+
+static I2C_TypeDef *port;
+// head is the transaction on the bus
+static I2cqTransaction *head = NULL;
+static I2cqTransaction *tail = NULL;
+// EMLIB keeps a pointer to the sequence until the transfer is done
+static I2C_TransferSeq_TypeDef seq;
+// the head transaction is on the bus
+static bool active = false;
+static I2cqStats stats;
+
+/***************************************************************************//**
+ * @brief Removes the head transaction from the queue, or leaves it there to
+ *        be started again if it failed and has retries left.
+ ******************************************************************************/
+static void complete(I2C_TransferReturn_TypeDef result) {
+	I2cqTransaction *t = head;
+
+	if (result != i2cTransferDone && t->attempts < t->retries) {
+		t->attempts++;
+		stats.retries++;
+		return;
+	}
+
+	head = t->next;
+	if (head == NULL) {
+		tail = NULL;
+	}
+	t->next = NULL;
+	t->result = result;
+	t->queued = false;
+
+	stats.transactions++;
+	if (result == i2cTransferDone) {
+		stats.bytes += t->readLen;
+		if (t->flags != I2C_FLAG_READ) {
+			stats.bytes += t->writeLen;
+		}
+	} else {
+		stats.failures++;
+	}
+	if (t->callback != NULL) {
+		t->callback(t);
+	}
+}
+
+/***************************************************************************//**
+ * @brief Starts the head transaction unless one is on the bus already. One
+ *        that fails right away, without an interrupt to follow, is completed
+ *        here and the next one started.
+ * @note  Runs in the I2C interrupt or with interrupts masked. EM2 is blocked
+ *        while a transfer is on the bus, because the I2C clock stops in EM2.
+ ******************************************************************************/
+static void start_head(void) {
+	// a callback run by complete() may have started the next one
+	while (head != NULL && !active) {
+		I2C_TransferReturn_TypeDef result;
+
+		seq.addr = head->addr;
+		seq.flags = head->flags;
+		if (head->flags == I2C_FLAG_READ) {
+			seq.buf[0].data = head->read;
+			seq.buf[0].len = head->readLen;
+		} else {
+			seq.buf[0].data = head->write;
+			seq.buf[0].len = head->writeLen;
+			seq.buf[1].data = head->read;
+			seq.buf[1].len = head->readLen;
+		}
+		result = I2C_TransferInit(port, &seq);
+		if (result == i2cTransferInProgress) {
+			active = true;
+			EVENTS_BlockEM2();
+			I2C_IntEnable(port, TRANSFER_IEN);
+		} else {
+			complete(result);
+		}
+	}
+}
+
+void I2C0_IRQHandler(void) {
+	I2C_TransferReturn_TypeDef result = I2C_Transfer(port);
+
+	if (result != i2cTransferInProgress) {
+		I2C_IntDisable(port, _I2C_IEN_MASK);
+		active = false;
+		EVENTS_UnblockEM2();
+		complete(result);
+		start_head();
+	}
+}
+
+void I2CQ_Init(I2C_TypeDef *i2c) {
+	port = i2c;
+	head = NULL;
+	tail = NULL;
+	active = false;
+
+	I2C_IntDisable(port, _I2C_IEN_MASK);
+	I2C_IntClear(port, _I2C_IF_MASK);
+	NVIC_ClearPendingIRQ(I2C0_IRQn);
+	NVIC_EnableIRQ(I2C0_IRQn);
+}
+
+bool I2CQ_Submit(I2cqTransaction *t) {
+	CORE_DECLARE_IRQ_STATE;
+
+	CORE_ENTER_CRITICAL();
+	if (t->queued) {
+		CORE_EXIT_CRITICAL();
+		return false;
+	}
+	t->queued = true;
+	t->attempts = 0;
+	t->result = i2cTransferInProgress;
+	t->next = NULL;
+
+	if (head == NULL) {
+		head = t;
+	} else {
+		tail->next = t;
+	}
+	tail = t;
+	start_head();
+	CORE_EXIT_CRITICAL();
+	return true;
+}
+
+/***************************************************************************//**
+ * @brief Runs a transaction to completion, sleeping in EM1 between the
+ *        interrupts of the transfer.
+ ******************************************************************************/
+I2C_TransferReturn_TypeDef I2CQ_Transfer(I2cqTransaction *t) {
+	CORE_DECLARE_IRQ_STATE;
+
+	if (!I2CQ_Submit(t)) {
+		return i2cTransferUsageFault;
+	}
+	CORE_ENTER_CRITICAL();
+	while (t->queued) {
+		EMU_EnterEM1();
+		CORE_EXIT_CRITICAL();
+		CORE_ENTER_CRITICAL();
+	}
+	CORE_EXIT_CRITICAL();
+	return t->result;
+}
+
+bool I2CQ_IsIdle(void) {
+	return head == NULL;
+}
+
+I2cqStats I2CQ_GetStats(void) {
+	return stats;
+}
@@ -0,0 +1,59 @@
+/*
+ * i2c_queue.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+#ifndef I2C_QUEUE_H
+#define I2C_QUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "em_device.h"
+#include "em_i2c.h"
+
+typedef struct I2cqTransaction I2cqTransaction;
+
+// t->result holds the outcome. Runs in the I2C interrupt, or in I2CQ_Submit
+// with interrupts masked if the transfer could not even start.
+typedef void (*I2cqCallback)(I2cqTransaction *t);
+
+// Filled in by the caller and owned by the queue from I2CQ_Submit until its
+// callback runs, so it must not live on the stack of a returning function.
+struct I2cqTransaction {
+	uint16_t addr; // 8-bit bus address, as in I2C_TransferSeq_TypeDef
+	uint16_t flags; // I2C_FLAG_WRITE, I2C_FLAG_READ or I2C_FLAG_WRITE_READ
+	uint8_t *write; // sent first, unused for I2C_FLAG_READ
+	uint16_t writeLen;
+	uint8_t *read;
+	uint16_t readLen;
+	uint8_t retries; // extra attempts after a failed one
+	I2cqCallback callback; // may be NULL
+	void *user;
+
+	// set by the queue
+	I2C_TransferReturn_TypeDef result;
+	uint8_t attempts;
+	bool queued;
+	I2cqTransaction *next;
+};
+
+typedef struct I2cqStats {
+	uint32_t transactions; // completed, successful or not
+	uint32_t failures; // completed with an error after all retries
+	uint32_t retries;
+	uint32_t bytes; // data bytes of successful transactions
+} I2cqStats;
+
+// takes over the interrupt of a port that I2CSPM_Init has configured
+void I2CQ_Init(I2C_TypeDef *i2c);
+// Appends t and starts it if the bus is idle. Safe to call from interrupt
+// context and from callbacks. Returns false if t is still queued.
+bool I2CQ_Submit(I2cqTransaction *t);
+// submits t and sleeps in EM1 until it completed, for start-up code
+I2C_TransferReturn_TypeDef I2CQ_Transfer(I2cqTransaction *t);
+bool I2CQ_IsIdle(void);
+I2cqStats I2CQ_GetStats(void);
+
+#endif /* I2C_QUEUE_H */
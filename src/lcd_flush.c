@@ -0,0 +1,139 @@
+/*
+ * lcd_flush.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "em_types.h"
+#include "display.h"
+#include "dmd.h"
+#include "lcd_flush.h"
+
+// Every addressed line carries a line address byte and a trailing dummy byte,
+// every transfer an update command byte and a final dummy byte.
+#define LCD_LINE_OVERHEAD     2
+#define LCD_TRANSFER_OVERHEAD 2
+
+#define FNV_OFFSET 2166136261u
+#define FNV_PRIME  16777619u
+
+/* Frame buffer GLIB draws into, selected as the DMD frame buffer */
+static uint8_t frame[LCD_HEIGHT][LCD_ROW_BYTES];
+/* Hash of every row as it was last transmitted */
+static uint32_t row_hash[LCD_HEIGHT];
+static bool shadow_valid = false;
+static bool diff_enabled = false;
+
+static DISPLAY_Device_t displayDevice;
+static LcdStats stats;
+
+static uint32_t hash_row(const uint8_t *row) {
+	uint32_t hash = FNV_OFFSET;
+
+	for (uint32_t i = 0; i < LCD_ROW_BYTES; i++) {
+		hash = (hash ^ row[i]) * FNV_PRIME;
+	}
+	return hash;
+}
+
+static void count_transfer(uint32_t lines) {
+	stats.transfers++;
+	stats.lines += lines;
+	stats.bytes += LCD_TRANSFER_OVERHEAD
+			+ lines * (LCD_ROW_BYTES + LCD_LINE_OVERHEAD);
+}
+
+static EMSTATUS flush_rows(uint32_t first, uint32_t count) {
+	count_transfer(count);
+	return displayDevice.pPixelMatrixDraw(&displayDevice, frame[first], 0,
+	LCD_WIDTH, first, count);
+}
+
+/***************************************************************************//**
+ * @brief Puts the shadow frame buffer between GLIB and the display driver.
+ * @note  Must be called after DMD_init. If the display does not match the
+ *        128x128 memory LCD with unpadded rows, LCD_Flush falls back to
+ *        DMD_updateDisplay.
+ ******************************************************************************/
+EMSTATUS LCD_Init(void) {
+	EMSTATUS status;
+
+	diff_enabled = false;
+	shadow_valid = false;
+
+	status = DISPLAY_DeviceGet(0, &displayDevice);
+	if (status != DISPLAY_EMSTATUS_OK) {
+		return status;
+	}
+	// the frame buffer rows are LCD_WIDTH pixels with no padding
+	if (displayDevice.geometry.width != LCD_WIDTH
+			|| displayDevice.geometry.height != LCD_HEIGHT
+			|| displayDevice.geometry.stride != LCD_WIDTH) {
+		return DISPLAY_EMSTATUS_INVALID_PARAMETER;
+	}
+
+	status = DMD_selectFramebuffer(frame);
+	if (status != DMD_OK) {
+		return status;
+	}
+
+	diff_enabled = true;
+	return DISPLAY_EMSTATUS_OK;
+}
+
+void LCD_Invalidate(void) {
+	shadow_valid = false;
+}
+
+uint8_t *LCD_GetFrame(void) {
+	return diff_enabled ? &frame[0][0] : NULL;
+}
+
+/***************************************************************************//**
+ * @brief Sends the dirty line ranges of the frame buffer to the display.
+ * @note  Clean rows split the frame into separate transfers. A clean row costs
+ *        18 bytes to resend while a new transfer only costs 2, so ranges are
+ *        never merged across clean rows.
+ ******************************************************************************/
+EMSTATUS LCD_Flush(void) {
+	EMSTATUS status = DISPLAY_EMSTATUS_OK;
+	int32_t first = -1;
+
+	stats.flushes++;
+
+	if (!diff_enabled) {
+		count_transfer(LCD_HEIGHT);
+		return DMD_updateDisplay();
+	}
+
+	for (uint32_t row = 0; row < LCD_HEIGHT; row++) {
+		uint32_t hash = hash_row(frame[row]);
+		bool dirty = !shadow_valid || hash != row_hash[row];
+
+		row_hash[row] = hash;
+		if (dirty) {
+			if (first < 0) {
+				first = row;
+			}
+		} else {
+			if (first >= 0) {
+				status |= flush_rows(first, row - first);
+				first = -1;
+			}
+		}
+	}
+	if (first >= 0) {
+		status |= flush_rows(first, LCD_HEIGHT - first);
+	}
+
+	// resend everything next time if the driver reported an error
+	shadow_valid = (status == DISPLAY_EMSTATUS_OK);
+	return status;
+}
+
+LcdStats LCD_GetStats(void) {
+	return stats;
+}
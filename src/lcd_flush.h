@@ -0,0 +1,36 @@
+/*
+ * lcd_flush.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+#ifndef LCD_FLUSH_H
+#define LCD_FLUSH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "em_types.h"
+
+#define LCD_WIDTH     128
+#define LCD_HEIGHT    128
+#define LCD_ROW_BYTES (LCD_WIDTH / 8)
+
+typedef struct LcdStats {
+	uint32_t flushes; // LCD_Flush calls
+	uint32_t transfers; // addressed multi-line writes started
+	uint32_t lines; // lines transmitted
+	uint32_t bytes; // SPI bytes transmitted, including command overhead
+} LcdStats;
+
+EMSTATUS LCD_Init(void);
+// transmits only the rows that differ from the last transmitted frame
+EMSTATUS LCD_Flush(void);
+// forces the next flush to transmit every row
+void LCD_Invalidate(void);
+// frame buffer GLIB draws into, LCD_ROW_BYTES per line, NULL if the DMD one
+// is in use
+uint8_t *LCD_GetFrame(void);
+LcdStats LCD_GetStats(void);
+
+#endif /* LCD_FLUSH_H */
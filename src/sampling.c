@@ -0,0 +1,126 @@
+/*
+ * sampling.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "sl_sleeptimer.h"
+#include "sl_sleeptimer_slack.h"
+#include "sl_sleeptimer_deferred.h"
+#include "event_queue.h"
+#include "sensor.h"
+#include "sampling.h"
+
+#define SECONDS_PER_HOUR 3600
+
+static sl_sleeptimer_timer_handle_t measurement_timer;
+static uint32_t base_ms = SAMPLING_BASE_MS;
+// the period is base_ms << backoff
+static uint32_t backoff = 0;
+static uint32_t stable = 0;
+static SensorSample previous;
+static bool have_previous = false;
+
+// sample statistics, counted over one hour windows
+static uint32_t samples = 0;
+static uint32_t samples_last_hour = 0;
+static bool hour_completed = false;
+static uint64_t window_start = 0;
+
+static void measurement_callback(sl_sleeptimer_timer_handle_t *handle,
+		void *data);
+
+static void start_timer(void) {
+	sl_sleeptimer_start_timer_slack_ms(&measurement_timer, base_ms << backoff,
+			SAMPLING_SLACK_MS, measurement_callback, NULL, 0,
+			SL_SLEEPTIMER_DEFERRED_CALLBACK_FLAG);
+}
+
+/***************************************************************************//**
+ * @brief Requests a measurement and starts the next period, which may have
+ *        changed since the last one.
+ ******************************************************************************/
+static void measurement_callback(sl_sleeptimer_timer_handle_t *handle,
+		void *data) {
+	(void) handle;
+	(void) data;
+	start_timer();
+	EVENTS_Post(EVENT_MEASURE, 0);
+}
+
+static uint32_t distance(int32_t a, int32_t b) {
+	return (a > b) ? (uint32_t) a - (uint32_t) b : (uint32_t) b - (uint32_t) a;
+}
+
+static void count_sample(void) {
+	uint64_t now = sl_sleeptimer_get_tick_count64();
+	uint64_t hour = (uint64_t) sl_sleeptimer_get_timer_frequency()
+			* SECONDS_PER_HOUR;
+
+	samples++;
+	if (now - window_start >= hour) {
+		samples_last_hour = samples;
+		hour_completed = true;
+		samples = 0;
+		window_start = now;
+	}
+}
+
+void SAMPLING_Init(uint32_t base) {
+	base_ms = (base != 0) ? base : SAMPLING_BASE_MS;
+	backoff = 0;
+	stable = 0;
+	have_previous = false;
+
+	samples = 0;
+	samples_last_hour = 0;
+	hour_completed = false;
+	window_start = sl_sleeptimer_get_tick_count64();
+
+	start_timer();
+}
+
+/***************************************************************************//**
+ * @brief Doubles the period after SAMPLING_STABLE_SAMPLES stable samples and
+ *        drops back to the base period, starting it over, on a change.
+ ******************************************************************************/
+void SAMPLING_Update(const SensorSample *sample) {
+	bool changed = have_previous
+			&& (distance(sample->temp, previous.temp) > SAMPLING_TEMP_DELTA_MC
+					|| distance(sample->rh, previous.rh) > SAMPLING_RH_DELTA);
+
+	count_sample();
+	previous = *sample;
+	have_previous = true;
+
+	if (changed) {
+		stable = 0;
+		if (backoff != 0) {
+			backoff = 0;
+			sl_sleeptimer_stop_timer(&measurement_timer);
+			start_timer();
+		}
+	} else if (++stable >= SAMPLING_STABLE_SAMPLES
+			&& backoff < SAMPLING_BACKOFF_MAX) {
+		// takes effect from the next period on
+		stable = 0;
+		backoff++;
+	}
+}
+
+void SAMPLING_Now(void) {
+	sl_sleeptimer_stop_timer(&measurement_timer);
+	start_timer();
+	EVENTS_Post(EVENT_MEASURE, 0);
+}
+
+uint32_t SAMPLING_GetPeriodMs(void) {
+	return base_ms << backoff;
+}
+
+uint32_t SAMPLING_GetSamplesPerHour(void) {
+	return hour_completed ? samples_last_hour : samples;
+}
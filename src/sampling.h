@@ -0,0 +1,38 @@
+/*
+ * sampling.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+#ifndef SAMPLING_H
+#define SAMPLING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "sensor.h"
+
+// period while the readings change
+#define SAMPLING_BASE_MS         2000
+// the period doubles after this many stable samples in a row...
+#define SAMPLING_STABLE_SAMPLES  3
+// ...up to SAMPLING_BASE_MS << SAMPLING_BACKOFF_MAX (64 s)
+#define SAMPLING_BACKOFF_MAX     5
+// a step larger than this between two samples is a change
+#define SAMPLING_TEMP_DELTA_MC   100
+#define SAMPLING_RH_DELTA        500
+// how late a measurement may run, enough to always share a clock tick
+#define SAMPLING_SLACK_MS        1000
+
+// Starts the measurement timer, which posts EVENT_MEASURE. base is the
+// shortest period in ms, 0 for SAMPLING_BASE_MS.
+void SAMPLING_Init(uint32_t base);
+// adapts the period to the step from the previous sample
+void SAMPLING_Update(const SensorSample *sample);
+// posts EVENT_MEASURE right away and counts the period from now
+void SAMPLING_Now(void);
+uint32_t SAMPLING_GetPeriodMs(void);
+// samples during the last full hour, or so far if less than an hour passed
+uint32_t SAMPLING_GetSamplesPerHour(void);
+
+#endif /* SAMPLING_H */
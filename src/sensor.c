@@ -0,0 +1,184 @@
+/*
+ * sensor.c
+ *
+ *  Created on: 16.10.2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "em_device.h"
+#include "em_core.h"
+#include "em_i2c.h"
+#include "sl_sleeptimer.h"
+#include "clock_control.h"
+#include "event_queue.h"
+#include "i2c_queue.h"
+#include "sensor.h"
+
+// Si7021 commands
+#define SI7021_MEASURE_RH_NO_HOLD 0xF5
+// temperature measured along with the last RH, no new conversion
+#define SI7021_READ_PREV_TEMP     0xE0
+#define SI7021_READ_ID2_1         0xFC
+#define SI7021_READ_ID2_2         0xC9
+
+// first byte of the second electronic ID word, as checked by Si7013_Detect
+#define SI7013_DEVICE_ID 0x0D
+#define SI7020_DEVICE_ID 0x14
+#define SI7021_DEVICE_ID 0x15
+
+// attempts of the measure command beyond the first
+#define SENSOR_COMMAND_RETRIES 2
+
+typedef enum SensorState {
+	SENSOR_IDLE,
+	SENSOR_COMMAND, // measure command queued
+	SENSOR_CONVERTING, // waiting on conversion_timer
+	SENSOR_READING // both reads queued
+} SensorState;
+
+static sl_sleeptimer_timer_handle_t conversion_timer;
+static volatile SensorState state = SENSOR_IDLE;
+static uint32_t polls;
+static SensorSample latest;
+static volatile bool valid = false;
+static uint32_t errors = 0;
+
+static uint8_t measure_command = SI7021_MEASURE_RH_NO_HOLD;
+static uint8_t temp_command = SI7021_READ_PREV_TEMP;
+static uint8_t rh_bytes[2];
+static uint8_t temp_bytes[2];
+
+static void command_done(I2cqTransaction *t);
+static void read_done(I2cqTransaction *t);
+
+static I2cqTransaction command_write = { .flags = I2C_FLAG_WRITE, .write =
+		&measure_command, .writeLen = 1, .retries = SENSOR_COMMAND_RETRIES,
+		.callback = command_done };
+static I2cqTransaction rh_read = { .flags = I2C_FLAG_READ, .read = rh_bytes,
+		.readLen = 2 };
+static I2cqTransaction temp_read = { .flags = I2C_FLAG_WRITE_READ, .write =
+		&temp_command, .writeLen = 1, .read = temp_bytes, .readLen = 2,
+		.callback = read_done };
+
+// measurement word, the two status bits masked off
+static uint32_t word(const uint8_t *data) {
+	return ((uint32_t) data[0] << 8) | (data[1] & 0xFC);
+}
+
+static void fail(void) {
+	errors++;
+	state = SENSOR_IDLE;
+}
+
+/***************************************************************************//**
+ * @brief Queues the RH read and, right behind it, the read of the
+ *        temperature of the same conversion.
+ ******************************************************************************/
+static void conversion_callback(sl_sleeptimer_timer_handle_t *handle,
+		void *data) {
+	(void) handle;
+	(void) data;
+
+	state = SENSOR_READING;
+	I2CQ_Submit(&rh_read);
+	I2CQ_Submit(&temp_read);
+}
+
+static void wait_conversion(uint32_t ms) {
+	state = SENSOR_CONVERTING;
+	sl_sleeptimer_start_timer_ms(&conversion_timer, ms, conversion_callback,
+			NULL, 0, 0);
+}
+
+static void command_done(I2cqTransaction *t) {
+	if (t->result != i2cTransferDone) {
+		fail();
+		return;
+	}
+	polls = 0;
+	wait_conversion(SENSOR_CONVERSION_MS);
+}
+
+/***************************************************************************//**
+ * @brief Runs after both reads. A NACK of the RH read means the conversion
+ *        is still running, both are queued again a little later.
+ ******************************************************************************/
+static void read_done(I2cqTransaction *t) {
+	if (rh_read.result == i2cTransferNack && ++polls < SENSOR_POLL_MAX) {
+		wait_conversion(SENSOR_POLL_MS);
+		return;
+	}
+	if (rh_read.result != i2cTransferDone || t->result != i2cTransferDone) {
+		fail();
+		return;
+	}
+
+	// conversions of the Si7013 driver
+	latest.rh = ((word(rh_bytes) * 15625) >> 13) - 6000;
+	latest.temp = (int32_t) ((word(temp_bytes) * 21965) >> 13) - 46850;
+	latest.time = CLOCK_Get(NULL);
+	valid = true;
+	state = SENSOR_IDLE;
+	EVENTS_Post(EVENT_SAMPLE, latest.time);
+}
+
+void SENSOR_Init(uint8_t addr) {
+	command_write.addr = addr;
+	rh_read.addr = addr;
+	temp_read.addr = addr;
+	state = SENSOR_IDLE;
+	valid = false;
+	errors = 0;
+}
+
+/***************************************************************************//**
+ * @brief Reads the electronic ID like Si7013_Detect, through the queue.
+ ******************************************************************************/
+bool SENSOR_Detect(void) {
+	uint8_t command[2] = { SI7021_READ_ID2_1, SI7021_READ_ID2_2 };
+	uint8_t id[8];
+	I2cqTransaction detect = { .addr = command_write.addr, .flags =
+			I2C_FLAG_WRITE_READ, .write = command, .writeLen = 2, .read = id,
+			.readLen = sizeof(id) };
+
+	if (I2CQ_Transfer(&detect) != i2cTransferDone) {
+		return false;
+	}
+	return id[0] == SI7013_DEVICE_ID || id[0] == SI7020_DEVICE_ID
+			|| id[0] == SI7021_DEVICE_ID;
+}
+
+/***************************************************************************//**
+ * @brief Queues the no-hold measure command. The conversion is waited out on
+ *        a timer instead of holding the bus, and the result is read from the
+ *        I2C interrupt.
+ ******************************************************************************/
+bool SENSOR_Start(void) {
+	if (state != SENSOR_IDLE) {
+		return false;
+	}
+	state = SENSOR_COMMAND;
+	I2CQ_Submit(&command_write);
+	return true;
+}
+
+bool SENSOR_IsBusy(void) {
+	return state != SENSOR_IDLE;
+}
+
+bool SENSOR_GetSample(SensorSample *sample) {
+	CORE_DECLARE_IRQ_STATE;
+
+	CORE_ENTER_ATOMIC();
+	if (valid) {
+		*sample = latest;
+	}
+	CORE_EXIT_ATOMIC();
+	return valid;
+}
+
+uint32_t SENSOR_GetErrorCount(void) {
+	return errors;
+}
@@ -0,0 +1,41 @@
+/*
+ * sensor.h
+ *
+ *  Created on: 16.10.2026
+ */
+
+#ifndef SENSOR_H
+#define SENSOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Si7021 conversion time of a 12-bit RH measurement including the 14-bit
+// temperature measured with it, datasheet maximum 12 + 10.8 ms
+#define SENSOR_CONVERSION_MS 23
+// the sensor NACKs its address until the conversion is done, a read that
+// came too early is retried this often, this far apart
+#define SENSOR_POLL_MS       2
+#define SENSOR_POLL_MAX      5
+
+typedef struct SensorSample {
+	uint32_t rh; // milli-percent
+	int32_t temp; // milli-degrees Celsius
+	uint32_t time; // CLOCK_Get() second of the read
+} SensorSample;
+
+// addr as the Si7013 driver takes it, already shifted (SI7021_ADDR). The
+// transfers go through the I2C queue, I2CQ_Init must have run.
+void SENSOR_Init(uint8_t addr);
+// blocking, true if a Si7013, Si7020 or Si7021 answers at addr
+bool SENSOR_Detect(void);
+// Starts a measurement that ends with EVENT_SAMPLE, data holding the
+// timestamp, or without an event if the sensor does not answer.
+// Returns false while the previous measurement is still running.
+bool SENSOR_Start(void);
+bool SENSOR_IsBusy(void);
+// latest sample, false until the first measurement succeeded
+bool SENSOR_GetSample(SensorSample *sample);
+uint32_t SENSOR_GetErrorCount(void);
+
+#endif /* SENSOR_H */